@@ -0,0 +1,25 @@
+/**
+  ******************************************************************************
+  * @file    config.h
+  * @author  Ngonidzashe Gwata
+  * @version V1.1.1
+  * @date    18-October-2026
+  * @brief   Host board configuration for replay builds, see stm8l15x.h in
+  *          this directory. There is no TMP102_I2C peripheral or GPIO pin to
+  *          name; the bus is tmp102_replay.c.
+  ******************************************************************************
+  *
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __CONFIG_H
+#define __CONFIG_H
+
+/* Private define ------------------------------------------------------------*/
+/* Replay runs in one thread without interrupts, the arbiter needs no lock */
+#define TMP102_ARB_LOCK(state)		((state) = 0)
+#define TMP102_ARB_UNLOCK(state)	((void)(state))
+
+#endif /* __CONFIG_H */
@@ -0,0 +1,45 @@
+/**
+  ******************************************************************************
+  * @file    stm8l15x.h
+  * @author  Ngonidzashe Gwata
+  * @version V1.1.1
+  * @date    18-October-2026
+  * @brief   Host stand-in for the STM8L15x SPL header. It carries only the
+  *          base types the driver uses, so the driver, tmp102_replay.c and
+  *          the arbiter build on a PC. Put host/ ahead of the SPL on the
+  *          include path; nothing here touches hardware.
+  *          C++ code, such as tmp102_async.hpp, keeps its built-in bool and
+  *          only gets TRUE and FALSE, so from C++ call no driver function
+  *          taking or returning bool.
+  ******************************************************************************
+  *
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM8L15x_H
+#define __STM8L15x_H
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Private typedef -----------------------------------------------------------*/
+#ifdef __cplusplus
+enum {FALSE = 0, TRUE = !FALSE};
+#else
+typedef enum {FALSE = 0, TRUE = !FALSE} bool;
+#endif
+typedef enum {RESET = 0, SET = !RESET} FlagStatus, ITStatus, BitStatus;
+typedef enum {DISABLE = 0, ENABLE = !DISABLE} FunctionalState;
+typedef enum {ERROR = 0, SUCCESS = !ERROR} ErrorStatus;
+
+/* Private define ------------------------------------------------------------*/
+#define __IO	volatile
+
+/* Private macro -------------------------------------------------------------*/
+/* A host process has no interrupts to mask */
+#define enableInterrupts()	((void)0)
+#define disableInterrupts()	((void)0)
+
+#endif /* __STM8L15x_H */
@@ -0,0 +1,239 @@
+/**
+  ******************************************************************************
+  * @file    tmp102_arbiter.c
+  * @author  Ngonidzashe Gwata
+  * @version V1.1.1
+  * @date    18-October-2026
+  * @brief   This file provides a bus arbiter for sharing the TMP102_I2C
+  *          peripheral with other drivers (EEPROM, RTC...).
+  *          Each driver describes a multi-step sequence, such as a pointer
+  *          write followed by a read, as a TMP102_Transaction. Transactions
+  *          are queued by priority, FIFO within a priority, and each runs to
+  *          completion before the next starts, so no START from another
+  *          driver can land between its steps. The TMP102 driver queues its
+  *          own sequences here when built with TMP102_USE_ARBITER.
+  *
+  *          Interrupt handlers may Submit and then check State; only thread
+  *          context may call Execute, which processes the queue itself.
+  ******************************************************************************
+ */
+
+#include "tmp102_arbiter.h"
+
+#ifndef TMP102_ARB_LOCK
+/* Restoring the saved CC instead of rim keeps an interrupt handler at its own
+   level and leaves interrupts masked in thread code that had them masked */
+#define TMP102_ARB_LOCK(state)		((state) = Arbiter_Lock())
+#define TMP102_ARB_UNLOCK(state)	Arbiter_Unlock(state)
+
+#if defined(__CSMC__)
+static uint8_t Arbiter_Lock(void)
+{
+  return (uint8_t)_asm("push cc\n pop a\n sim");
+}
+
+static void Arbiter_Unlock(uint8_t state)
+{
+  _asm("push a\n pop cc", state);
+}
+#elif defined(__IAR_SYSTEMS_ICC__)
+#include <intrinsics.h>
+
+static uint8_t Arbiter_Lock(void)
+{
+  __istate_t state = __get_interrupt_state();
+
+  __disable_interrupt();
+  return (uint8_t)state;
+}
+
+static void Arbiter_Unlock(uint8_t state)
+{
+  __set_interrupt_state((__istate_t)state);
+}
+#elif defined(__SDCC)
+static uint8_t Arbiter_Lock(void) __naked
+{
+  __asm
+    push cc
+    pop a
+    sim
+    ret
+  __endasm;
+}
+
+static void Arbiter_Unlock(uint8_t state) __naked
+{
+  (void)state;
+  __asm
+#if defined(__SDCCCALL) && __SDCCCALL == 1
+    push a
+#else
+    ld a, (3, sp)
+    push a
+#endif
+    pop cc
+    ret
+  __endasm;
+}
+#else
+#error "Define TMP102_ARB_LOCK(state) and TMP102_ARB_UNLOCK(state) for this compiler"
+#endif
+#endif /* TMP102_ARB_LOCK */
+
+static TMP102_Transaction *Head;
+static bool Running;
+static uint32_t (*Tick)(void);
+static TMP102_ArbiterStats Stats;
+
+/**
+  * @brief  Set the tick source used to measure queue wait times.
+  * @param  GetTick: returns a free running tick count, 0 to leave waits at 0.
+  * @retval None
+  */
+void TMP102_Arbiter_Init(uint32_t (*GetTick)(void))
+{
+  Head = 0;
+  Running = FALSE;
+  Tick = GetTick;
+  Stats.Depth = 0;
+  TMP102_Arbiter_ResetStats();
+}
+
+/**
+  * @brief  Queue a transaction.
+  * @param  txn: Steps, NumStep and Priority filled in, must stay valid until done.
+  * @retval None
+  */
+void TMP102_Arbiter_Submit(TMP102_Transaction *txn)
+{
+  TMP102_Transaction **link;
+  uint8_t state;
+
+  txn->State = TMP102_ARB_QUEUED;
+  txn->Submitted = Tick ? Tick() : 0;
+
+  TMP102_ARB_LOCK(state);
+  link = &Head;
+  while (*link && (*link)->Priority <= txn->Priority)
+  {
+    link = &(*link)->Next;
+  }
+  txn->Next = *link;
+  *link = txn;
+  if (++Stats.Depth > Stats.MaxDepth)
+  {
+    Stats.MaxDepth = Stats.Depth;
+  }
+  TMP102_ARB_UNLOCK(state);
+}
+
+/**
+  * @brief  Run queued transactions until the queue is empty.
+  * @param  None
+  * @retval None
+  * @Note 	Returns at once if another context is already processing.
+  */
+void TMP102_Arbiter_Process(void)
+{
+  TMP102_Transaction *txn;
+  TMP102_BusStep *step;
+  ErrorStatus status;
+  uint32_t wait;
+  uint8_t i, state;
+
+  TMP102_ARB_LOCK(state);
+  if (Running)
+  {
+    TMP102_ARB_UNLOCK(state);
+    return;
+  }
+  Running = TRUE;
+
+  while ((txn = Head) != 0)
+  {
+    Head = txn->Next;
+    Stats.Depth--;
+    wait = Tick ? Tick() - txn->Submitted : 0;
+    Stats.TotalWait += wait;
+    if (wait > Stats.MaxWait)
+    {
+      Stats.MaxWait = wait;
+    }
+    txn->State = TMP102_ARB_RUNNING;
+    TMP102_ARB_UNLOCK(state);
+
+    status = SUCCESS;
+    step = txn->Steps;
+    for (i = 0; i < txn->NumStep && status == SUCCESS; i++, step++)
+    {
+      if (step->Address & TMP102_BUS_READ)
+      {
+        status = TMP102_Bus_Read(step->Address, step->pBuffer, step->NumByte);
+      }
+      else
+      {
+        status = TMP102_Bus_Write(step->Address, step->pBuffer, step->NumByte);
+      }
+    }
+
+    TMP102_ARB_LOCK(state);
+    if (status == SUCCESS)
+    {
+      Stats.Completed++;
+      txn->State = TMP102_ARB_DONE;
+    }
+    else
+    {
+      Stats.Errors++;
+      txn->State = TMP102_ARB_ERROR;
+    }
+  }
+
+  Running = FALSE;
+  TMP102_ARB_UNLOCK(state);
+}
+
+/**
+  * @brief  Queue a transaction and run the queue until it is complete.
+  * @param  txn: as for TMP102_Arbiter_Submit.
+  * @retval SUCCESS if every step completed.
+  * @Note 	More urgent transactions already queued run first.
+  */
+ErrorStatus TMP102_Arbiter_Execute(TMP102_Transaction *txn)
+{
+  TMP102_Arbiter_Submit(txn);
+  while (txn->State == TMP102_ARB_QUEUED || txn->State == TMP102_ARB_RUNNING)
+  {
+    TMP102_Arbiter_Process();
+  }
+  return (txn->State == TMP102_ARB_DONE) ? SUCCESS : ERROR;
+}
+
+/**
+  * @brief  Copy the queue metrics.
+  */
+void TMP102_Arbiter_GetStats(TMP102_ArbiterStats *stats)
+{
+  uint8_t state;
+
+  TMP102_ARB_LOCK(state);
+  *stats = Stats;
+  TMP102_ARB_UNLOCK(state);
+}
+
+/**
+  * @brief  Clear the metrics, the current depth is kept.
+  */
+void TMP102_Arbiter_ResetStats(void)
+{
+  uint8_t state;
+
+  TMP102_ARB_LOCK(state);
+  Stats.MaxDepth = Stats.Depth;
+  Stats.Completed = 0;
+  Stats.Errors = 0;
+  Stats.MaxWait = 0;
+  Stats.TotalWait = 0;
+  TMP102_ARB_UNLOCK(state);
+}
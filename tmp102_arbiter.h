@@ -0,0 +1,74 @@
+/**
+  ******************************************************************************
+  * @file    tmp102_arbiter.h
+  * @author  Ngonidzashe Gwata
+  * @version V1.1.1
+  * @date    18-October-2026
+  * @brief   This file contains all the functions prototypes for the
+  *          bus arbiter shared by every driver on the TMP102_I2C peripheral.
+  ******************************************************************************
+  *
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __TMP102_ARBITER_H
+#define __TMP102_ARBITER_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "tmp102_bus.h"
+
+/* Private define ------------------------------------------------------------*/
+#define TMP102_ARB_QUEUED	0	/*!< Waiting in the queue */
+#define TMP102_ARB_RUNNING	1	/*!< Steps being put on the bus */
+#define TMP102_ARB_DONE		2	/*!< Every step completed */
+#define TMP102_ARB_ERROR	3	/*!< A step failed, the rest were skipped */
+
+#ifndef TMP102_ARB_PRIORITY
+#define TMP102_ARB_PRIORITY	0	/*!< Priority of the TMP102 driver's own sequences */
+#endif
+
+/* Protects the queue against Submit from interrupt context. TMP102_ARB_LOCK(state)
+   saves the interrupt mask into a uint8_t and masks interrupts, TMP102_ARB_UNLOCK(state)
+   puts the saved mask back. Defaults exist for Cosmic, IAR and SDCC, define both for
+   any other compiler */
+
+/* Private typedef -----------------------------------------------------------*/
+/**
+  * @brief  A bus sequence run as one unit, owned by the submitter until it
+  *         leaves the TMP102_ARB_QUEUED and TMP102_ARB_RUNNING states.
+  */
+typedef struct TMP102_Transaction_s
+{
+  TMP102_BusStep *Steps;
+  uint8_t NumStep;
+  uint8_t Priority;		/*!< 0 is the most urgent */
+  __IO uint8_t State;	/*!< TMP102_ARB_xx */
+  uint32_t Submitted;	/*!< Tick at submission */
+  struct TMP102_Transaction_s *Next;
+} TMP102_Transaction;
+
+/**
+  * @brief  Queue metrics, wait is measured from Submit to the first step.
+  */
+typedef struct
+{
+  uint8_t Depth;		/*!< Transactions queued now */
+  uint8_t MaxDepth;
+  uint16_t Completed;
+  uint16_t Errors;
+  uint32_t MaxWait;		/*!< Ticks */
+  uint32_t TotalWait;	/*!< Ticks, divide by Completed + Errors for the mean */
+} TMP102_ArbiterStats;
+
+/* Private macro -------------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+	void TMP102_Arbiter_Init(uint32_t (*GetTick)(void));	// Tick source for wait times, may be 0
+	void TMP102_Arbiter_Submit(TMP102_Transaction *txn);	// Queue behind equal or more urgent transactions
+	void TMP102_Arbiter_Process(void);	// Run queued transactions, most urgent first
+	ErrorStatus TMP102_Arbiter_Execute(TMP102_Transaction *txn);	// Submit and process until txn is complete
+	void TMP102_Arbiter_GetStats(TMP102_ArbiterStats *stats);
+	void TMP102_Arbiter_ResetStats(void);
+
+#endif /* __TMP102_ARBITER_H */
@@ -0,0 +1,312 @@
+/**
+  ******************************************************************************
+  * @file    tmp102_async.c
+  * @author  Ngonidzashe Gwata
+  * @version V1.1.1
+  * @date    18-October-2026
+  * @brief   This file provides a non-blocking access layer for the TMP102.
+  *          Every request is a small state machine held in a
+  *          TMP102_AsyncSensor and runs as the same units of TMP102_BusSteps
+  *          the blocking driver uses, each leaving the pointer register on
+  *          the temperature register. Units go to the sensor's
+  *          TMP102_AsyncBus, an adapter that starts a unit and later reports
+  *          it finished, so one thread calling TMP102_Async_Poll keeps
+  *          hundreds of sensors in flight. Adapters progress side by side;
+  *          sensors sharing an adapter take turns one unit at a time, so one
+  *          sensor waiting on a conversion never holds the bus.
+  *          Two transports are provided: TMP102_Async_DriverBegin/Check run
+  *          units through TMP102_Transfer, so the arbiter, capture and every
+  *          bus backend apply, and tmp102_bus_sim.c simulates buses on a host.
+  *          The driver's backends block, so over the driver transport each
+  *          unit runs to completion inside TMP102_Async_Poll and no two units
+  *          overlap; only the waits between units, such as a conversion,
+  *          are shared out. Bus time overlaps only with a transport whose
+  *          Begin really returns at once, as the simulator's does.
+  *          tmp102_async.hpp puts C++20 coroutines on top for host code.
+  ******************************************************************************
+ */
+
+#include "tmp102_async.h"
+
+/* Request kinds */
+#define TMP102_ASYNC_OP_READ_TEMP	0
+#define TMP102_ASYNC_OP_ONE_SHOT	1
+
+/**
+  * @brief  Wait for the bus behind the other sensors of the adapter.
+  */
+static void Async_Queue(TMP102_AsyncSensor *sensor, uint8_t NumStep)
+{
+  TMP102_AsyncBus *bus = sensor->Bus;
+
+  sensor->NumStep = NumStep;
+  sensor->Next = 0;
+  if (bus->Tail)
+  {
+    bus->Tail->Next = sensor;
+  }
+  else
+  {
+    bus->Head = sensor;
+  }
+  bus->Tail = sensor;
+}
+
+/* Temperature register, the pointer already rests on it */
+static void Async_ReadTemp(TMP102_AsyncSensor *sensor)
+{
+  TMP102_SetStep(&sensor->Steps[0], sensor->Address | TMP102_BUS_READ, sensor->Rx, 2);
+  Async_Queue(sensor, 1);
+}
+
+/* Configuration register, then point back to temperature register */
+static void Async_ReadConfig(TMP102_AsyncSensor *sensor)
+{
+  sensor->Tx[0] = CONFIG_REGISTER;
+  TMP102_SetStep(&sensor->Steps[0], sensor->Address, sensor->Tx, 1);
+  TMP102_SetStep(&sensor->Steps[1], sensor->Address | TMP102_BUS_READ, sensor->Rx, 2);
+  TMP102_SetStep(&sensor->Steps[2], sensor->Address, &sensor->Temp, 1);
+  Async_Queue(sensor, 3);
+}
+
+static void Async_WriteConfig(TMP102_AsyncSensor *sensor, uint16_t RegValue)
+{
+  sensor->Tx[0] = CONFIG_REGISTER;
+  sensor->Tx[1] = (uint8_t)(RegValue >> 8);
+  sensor->Tx[2] = (uint8_t)RegValue;
+  TMP102_SetStep(&sensor->Steps[0], sensor->Address, sensor->Tx, 3);
+  TMP102_SetStep(&sensor->Steps[1], sensor->Address, &sensor->Temp, 1);
+  Async_Queue(sensor, 2);
+}
+
+static void Async_Finish(TMP102_AsyncSensor *sensor, TMP102_AsyncStatus status)
+{
+  sensor->Status = (uint8_t)status;
+  if (sensor->Done)
+  {
+    sensor->Done(sensor);
+  }
+}
+
+/**
+  * @brief  The last unit completed: queue the next one, or complete the request.
+  */
+static void Async_Advance(TMP102_AsyncSensor *sensor)
+{
+  uint16_t value = (uint16_t)((sensor->Rx[0] << 8) | sensor->Rx[1]);
+
+  if (sensor->Op == TMP102_ASYNC_OP_READ_TEMP)
+  {
+    if (sensor->Step++ == 0)
+    {
+      Async_ReadTemp(sensor);
+      return;
+    }
+    // Bit 0  will always be 0 in 12-bit readings and 1 in 13-bit
+    sensor->Raw = TMP102_RegToCounts(value, (bool)(value & 0x01));
+    Async_Finish(sensor, TMP102_ASYNC_DONE);
+    return;
+  }
+
+  switch (sensor->Step++)
+  {
+  case 0:	// read current configuration
+    Async_ReadConfig(sensor);
+    break;
+  case 1:	// set OS, every other bit as read
+    Async_WriteConfig(sensor, value | 0x8000);
+    sensor->Polls = TMP102_ASYNC_OS_POLLS;
+    break;
+  case 2:	// poll OS (0-not ready, 1-conversion complete)
+    Async_ReadConfig(sensor);
+    break;
+  case 3:
+    if ((value & 0x8000) == 0)
+    {
+      if (--sensor->Polls == 0)
+      {
+        Async_Finish(sensor, TMP102_ASYNC_ERROR);
+        break;
+      }
+      sensor->Step = 3;
+      Async_ReadConfig(sensor);
+      break;
+    }
+    Async_ReadTemp(sensor);
+    break;
+  default:
+    sensor->Raw = TMP102_RegToCounts(value, (bool)(value & 0x01));
+    Async_Finish(sensor, TMP102_ASYNC_DONE);
+    break;
+  }
+}
+
+/**
+  * @brief  Bind an adapter to its transport.
+  * @param  Begin: puts a unit on the bus and returns, ERROR if it could not.
+  * @param  Check: TMP102_ARB_RUNNING until the unit ends, then TMP102_ARB_DONE
+  *         or TMP102_ARB_ERROR.
+  * @param  Port: passed to Begin and Check, such as the bus handle.
+  * @retval None
+  */
+void TMP102_Async_InitBus(TMP102_AsyncBus *bus,
+                          ErrorStatus (*Begin)(void *Port, TMP102_BusStep *Steps, uint8_t NumStep),
+                          uint8_t (*Check)(void *Port), void *Port)
+{
+  bus->Begin = Begin;
+  bus->Check = Check;
+  bus->Port = Port;
+  bus->Owner = 0;
+  bus->Head = 0;
+  bus->Tail = 0;
+}
+
+/**
+  * @brief  Bind a context to a sensor.
+  * @param  bus: adapter the sensor is connected to.
+  * @param  Address: sensor address, shifted left as TMP102_ADDR.
+  * @param  Done: called from TMP102_Async_Poll when a request ends, may be 0.
+  *         It may start the next request on the sensor.
+  * @retval None
+  */
+void TMP102_Async_Init(TMP102_AsyncSensor *sensor, TMP102_AsyncBus *bus, uint8_t Address,
+                       void (*Done)(TMP102_AsyncSensor *sensor))
+{
+  sensor->Bus = bus;
+  sensor->Next = 0;
+  sensor->Done = Done;
+  sensor->Address = Address;
+  sensor->Temp = TEMPERATURE_REGISTER;
+  sensor->Status = TMP102_ASYNC_IDLE;
+}
+
+static ErrorStatus Async_Start(TMP102_AsyncSensor *sensor, uint8_t Op)
+{
+  if (sensor->Status == TMP102_ASYNC_BUSY)
+  {
+    return ERROR;
+  }
+  sensor->Op = Op;
+  sensor->Step = 0;
+  sensor->Status = TMP102_ASYNC_BUSY;
+  Async_Advance(sensor);
+  return SUCCESS;
+}
+
+/**
+  * @brief  Start reading the temperature register.
+  * @retval ERROR if a request is already in progress on the sensor.
+  * @Note 	As readTempRaw, this assumes the pointer register is on the temperature register.
+  */
+ErrorStatus TMP102_Async_StartReadTemp(TMP102_AsyncSensor *sensor)
+{
+  return Async_Start(sensor, TMP102_ASYNC_OP_READ_TEMP);
+}
+
+/**
+  * @brief  Start a one-shot conversion and read its result once OS reports it complete.
+  * @retval ERROR if a request is already in progress on the sensor.
+  * @Note 	The sensor should be in shutdown mode (tmp102_sleep), otherwise OS never
+  *         reads back 1 and the request ends in TMP102_ASYNC_ERROR.
+  */
+ErrorStatus TMP102_Async_StartOneShot(TMP102_AsyncSensor *sensor)
+{
+  return Async_Start(sensor, TMP102_ASYNC_OP_ONE_SHOT);
+}
+
+/**
+  * @brief  Collect finished units and start waiting ones, never waits.
+  * @param  bus: adapters to service.
+  * @param  count: number of adapters.
+  * @retval adapters with a unit running or waiting, 0 once every request has ended.
+  * @Note 	Call it again when an adapter may have finished a unit, for
+  *         instance from a loop that sleeps until the next bus event.
+  */
+uint16_t TMP102_Async_Poll(TMP102_AsyncBus *const *bus, uint16_t count)
+{
+  TMP102_AsyncBus *b;
+  TMP102_AsyncSensor *sensor;
+  uint16_t i, busy = 0;
+  uint8_t state;
+
+  for (i = 0; i < count; i++)
+  {
+    b = bus[i];
+    if (b->Owner && (state = b->Check(b->Port)) != TMP102_ARB_RUNNING)
+    {
+      // Hand the bus over first, the sensor queues its next unit behind the others
+      sensor = b->Owner;
+      b->Owner = 0;
+      if (state == TMP102_ARB_DONE)
+      {
+        Async_Advance(sensor);
+      }
+      else
+      {
+        Async_Finish(sensor, TMP102_ASYNC_ERROR);
+      }
+    }
+    while (!b->Owner && b->Head)
+    {
+      sensor = b->Head;
+      b->Head = sensor->Next;
+      if (!b->Head)
+      {
+        b->Tail = 0;
+      }
+      b->Owner = sensor;
+      if (b->Begin(b->Port, sensor->Steps, sensor->NumStep) != SUCCESS)
+      {
+        b->Owner = 0;
+        Async_Finish(sensor, TMP102_ASYNC_ERROR);
+      }
+    }
+    busy += (b->Owner || b->Head);
+  }
+  return busy;
+}
+
+/**
+  * @brief  Adapter transport over the driver's own bus path.
+  * @param  Port: a TMP102_Transaction owned by the adapter.
+  * @retval SUCCESS
+  * @Note 	With TMP102_USE_ARBITER the unit is queued on the arbiter and
+  *         TMP102_Async_DriverCheck runs the queue, otherwise it runs here
+  *         through TMP102_Transfer and Check only reports the result.
+  *         Either way the unit blocks TMP102_Async_Poll for its whole bus
+  *         time, so sensors on driver adapters never have units in flight
+  *         together; they only take turns while each waits on a conversion.
+  */
+ErrorStatus TMP102_Async_DriverBegin(void *Port, TMP102_BusStep *Steps, uint8_t NumStep)
+{
+  TMP102_Transaction *txn = (TMP102_Transaction *)Port;
+
+#ifdef TMP102_USE_ARBITER
+  txn->Steps = Steps;
+  txn->NumStep = NumStep;
+  txn->Priority = TMP102_ARB_PRIORITY;
+  TMP102_Arbiter_Submit(txn);
+#else
+  txn->State = (TMP102_Transfer(Steps, NumStep) == SUCCESS) ? TMP102_ARB_DONE : TMP102_ARB_ERROR;
+#endif
+  return SUCCESS;
+}
+
+/**
+  * @brief  State of the unit started by TMP102_Async_DriverBegin.
+  * @param  Port: the adapter's TMP102_Transaction.
+  * @retval TMP102_ARB_RUNNING, TMP102_ARB_DONE or TMP102_ARB_ERROR.
+  */
+uint8_t TMP102_Async_DriverCheck(void *Port)
+{
+  TMP102_Transaction *txn = (TMP102_Transaction *)Port;
+
+#ifdef TMP102_USE_ARBITER
+  TMP102_Arbiter_Process();
+  if (txn->State == TMP102_ARB_QUEUED)
+  {
+    return TMP102_ARB_RUNNING;
+  }
+#endif
+  return txn->State;
+}
@@ -0,0 +1,104 @@
+/**
+  ******************************************************************************
+  * @file    tmp102_async.h
+  * @author  Ngonidzashe Gwata
+  * @version V1.1.1
+  * @date    18-October-2026
+  * @brief   This file contains all the functions prototypes for the
+  *          non-blocking tmp102 access layer.
+  ******************************************************************************
+  *
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __TMP102_ASYNC_H
+#define __TMP102_ASYNC_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "tmp102_i2c.h"
+#include "tmp102_arbiter.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/**
+  * @brief  State of an asynchronous request
+  */
+typedef enum
+{
+  TMP102_ASYNC_IDLE = 0,	/*!< No request started */
+  TMP102_ASYNC_BUSY,		/*!< Request in progress */
+  TMP102_ASYNC_DONE,		/*!< Request complete, Raw is valid */
+  TMP102_ASYNC_ERROR		/*!< Sensor did not answer or conversion never completed */
+} TMP102_AsyncStatus;
+
+typedef struct TMP102_AsyncSensor_s TMP102_AsyncSensor;
+
+/**
+  * @brief  One bus adapter. Begin puts a unit of TMP102_BusSteps on the bus
+  *         and returns without waiting, Check reports TMP102_ARB_RUNNING
+  *         until it ends, then TMP102_ARB_DONE or TMP102_ARB_ERROR. Sensors
+  *         on an adapter take turns one unit at a time.
+  */
+typedef struct
+{
+  ErrorStatus (*Begin)(void *Port, TMP102_BusStep *Steps, uint8_t NumStep);
+  uint8_t (*Check)(void *Port);
+  void *Port;					/*!< Handed to Begin and Check */
+  TMP102_AsyncSensor *Owner;	/*!< Sensor whose unit is on the bus */
+  TMP102_AsyncSensor *Head;		/*!< Sensors waiting for the bus, oldest first */
+  TMP102_AsyncSensor *Tail;
+} TMP102_AsyncBus;
+
+/**
+  * @brief  Per sensor request context. One of these is all a pending sensor
+  *         costs, there is no stack or thread behind it.
+  */
+struct TMP102_AsyncSensor_s
+{
+  TMP102_AsyncBus *Bus;
+  TMP102_AsyncSensor *Next;		/*!< Link in the adapter's queue */
+  void (*Done)(TMP102_AsyncSensor *sensor);	/*!< Called when a request ends, may be 0 */
+  void *User;					/*!< Free for the application */
+  TMP102_BusStep Steps[3];		/*!< Unit being run */
+  uint8_t Tx[3];				/*!< Register pointer and data */
+  uint8_t Rx[2];
+  uint8_t Temp;					/*!< TEMPERATURE_REGISTER, pointer restore */
+  uint8_t Address;				/*!< Sensor address, shifted left as TMP102_ADDR */
+  uint8_t NumStep;
+  uint8_t Op;					/*!< Request being executed */
+  uint8_t Step;					/*!< Position within the request */
+  uint8_t Status;				/*!< TMP102_AsyncStatus */
+  uint16_t Polls;				/*!< OS polls left before a one-shot is abandoned */
+  int16_t Raw;					/*!< Temperature in 1/16 C once DONE, as readTempRaw */
+};
+
+/* Private define ------------------------------------------------------------*/
+#ifndef TMP102_ASYNC_OS_POLLS
+#define TMP102_ASYNC_OS_POLLS	(uint16_t)0x3FF	/*!< Config reads while waiting on a one-shot */
+#endif
+
+/* Private macro -------------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+	// Bind an adapter to its transport, Port is passed back to Begin and Check
+	void TMP102_Async_InitBus(TMP102_AsyncBus *bus,
+	                          ErrorStatus (*Begin)(void *Port, TMP102_BusStep *Steps, uint8_t NumStep),
+	                          uint8_t (*Check)(void *Port), void *Port);
+
+	// Bind a context to the sensor at Address on bus, Done may be 0
+	void TMP102_Async_Init(TMP102_AsyncSensor *sensor, TMP102_AsyncBus *bus, uint8_t Address,
+	                       void (*Done)(TMP102_AsyncSensor *sensor));
+
+	ErrorStatus TMP102_Async_StartReadTemp(TMP102_AsyncSensor *sensor);	// Queue a temperature register read
+	ErrorStatus TMP102_Async_StartOneShot(TMP102_AsyncSensor *sensor);	// Trigger a conversion and read it once complete
+
+	// Move every adapter on by whatever has completed, never waits, returns adapters still busy
+	uint16_t TMP102_Async_Poll(TMP102_AsyncBus *const *bus, uint16_t count);
+
+	// Adapter transport over TMP102_Transfer, so arbiter, capture and every backend apply.
+	// Port is a TMP102_Transaction per adapter. The backends block: each unit runs to the
+	// end inside TMP102_Async_Poll, so units never overlap, only conversion waits do
+	ErrorStatus TMP102_Async_DriverBegin(void *Port, TMP102_BusStep *Steps, uint8_t NumStep);
+	uint8_t TMP102_Async_DriverCheck(void *Port);
+
+#endif /* __TMP102_ASYNC_H */
@@ -0,0 +1,222 @@
+/**
+  ******************************************************************************
+  * @file    tmp102_async.hpp
+  * @author  Ngonidzashe Gwata
+  * @version V1.1.1
+  * @date    18-October-2026
+  * @brief   Host-only C++20 coroutine front end for the non-blocking layer.
+  *          tmp102_async.c stays the engine: tmp102::Sensor wraps one
+  *          TMP102_AsyncSensor and its requests are awaitables, resumed from
+  *          the request's Done callback, and tmp102::Executor drives
+  *          TMP102_Async_Poll. Gateway code then reads as straight-line code:
+  *            tmp102::Task Watch(tmp102::Sensor &dev)
+  *            {
+  *              for (;;)
+  *              {
+  *                std::optional<int16_t> raw = co_await dev.OneShot();
+  *                ...
+  *              }
+  *            }
+  *          co_await in statements, not in both arms of ?:, which GCC 12
+  *          evaluates both of when the result is assigned.
+  *          Coroutines resume inside TMP102_Async_Poll, on the executor's
+  *          thread; none of this is thread safe. Build the C files as C
+  *          and this header with -std=c++20, host/ first on the include path.
+  ******************************************************************************
+  *
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __TMP102_ASYNC_HPP
+#define __TMP102_ASYNC_HPP
+
+/* Includes ------------------------------------------------------------------*/
+#include <coroutine>
+#include <cstdint>
+#include <exception>
+#include <optional>
+#include <utility>
+
+extern "C"
+{
+#include "tmp102_async.h"
+}
+
+namespace tmp102
+{
+
+/**
+  * @brief  Coroutine that starts at once and runs until its first co_await.
+  *         The Task owns the frame and destroys it when it goes out of scope,
+  *         so keep it until Done() or the frame is lost mid request.
+  */
+class Task
+{
+public:
+  struct promise_type
+  {
+    Task get_return_object()
+    {
+      return Task(std::coroutine_handle<promise_type>::from_promise(*this));
+    }
+    std::suspend_never initial_suspend() noexcept { return {}; }
+    std::suspend_always final_suspend() noexcept { return {}; }
+    void return_void() noexcept {}
+    void unhandled_exception() noexcept { std::terminate(); }
+  };
+
+  Task(Task &&other) noexcept : Handle(std::exchange(other.Handle, {})) {}
+  Task(const Task &) = delete;
+  Task &operator=(const Task &) = delete;
+  ~Task()
+  {
+    if (Handle)
+    {
+      Handle.destroy();
+    }
+  }
+
+  bool Done() const { return !Handle || Handle.done(); }
+
+private:
+  explicit Task(std::coroutine_handle<promise_type> handle) : Handle(handle) {}
+
+  std::coroutine_handle<promise_type> Handle;
+};
+
+/**
+  * @brief  One sensor on an adapter. Its TMP102_AsyncSensor is set up with
+  *         a Done callback and User pointing back here, leave both alone.
+  *         One request at a time: awaiting a second one while the first is
+  *         in flight yields std::nullopt at once.
+  */
+class Sensor
+{
+public:
+  Sensor(TMP102_AsyncBus &bus, uint8_t Address)
+  {
+    TMP102_Async_Init(&State, &bus, Address, &Sensor::Resume);
+    State.User = this;
+  }
+  Sensor(const Sensor &) = delete;
+  Sensor &operator=(const Sensor &) = delete;
+
+  /**
+    * @brief  A request; co_await yields the temperature in 1/16 C, as
+    *         readTempRaw, or std::nullopt if the sensor did not answer.
+    */
+  class Request
+  {
+  public:
+    Request(Sensor &sensor, ErrorStatus (*start)(TMP102_AsyncSensor *))
+      : Owner(sensor), Start(start) {}
+
+    bool await_ready() const noexcept { return false; }
+    bool await_suspend(std::coroutine_handle<> waiter)
+    {
+      Owner.Waiter = waiter;
+      Started = (Start(&Owner.State) == SUCCESS);
+      if (!Started)
+      {
+        Owner.Waiter = {};
+      }
+      return Started;	// not started, carry on without suspending
+    }
+    std::optional<int16_t> await_resume() const
+    {
+      if (!Started || Owner.State.Status != TMP102_ASYNC_DONE)
+      {
+        return std::nullopt;
+      }
+      return Owner.State.Raw;
+    }
+
+  private:
+    Sensor &Owner;
+    ErrorStatus (*Start)(TMP102_AsyncSensor *);
+    bool Started = false;
+  };
+
+  Request ReadTemp() { return Request(*this, TMP102_Async_StartReadTemp); }	// Temperature register
+  Request OneShot() { return Request(*this, TMP102_Async_StartOneShot); }	// One-shot conversion, sensor in shutdown
+
+  uint8_t Address() const { return State.Address; }
+  TMP102_AsyncSensor *Context() { return &State; }	// The C context underneath
+
+private:
+  static void Resume(TMP102_AsyncSensor *context)
+  {
+    Sensor *self = static_cast<Sensor *>(context->User);
+    std::coroutine_handle<> waiter = std::exchange(self->Waiter, {});
+
+    if (waiter)
+    {
+      waiter.resume();
+    }
+  }
+
+  TMP102_AsyncSensor State;
+  std::coroutine_handle<> Waiter;
+};
+
+/**
+  * @brief  Drives a set of adapters until no request is left. Between
+  *         polls with work in flight it calls Idle, which should sleep until
+  *         the next unit may have ended (TMP102_Sim_Wait on the simulator)
+  *         or may be 0 to spin.
+  */
+class Executor
+{
+public:
+  Executor(TMP102_AsyncBus *const *bus, uint16_t count,
+           void (*idle)(void *context) = 0, void *context = 0)
+    : Bus(bus), Count(count), Idle(idle), IdleContext(context) {}
+
+  // Poll until every adapter is idle, coroutines resume in here
+  void Run()
+  {
+    uint16_t busy;
+
+    for (;;)
+    {
+      busy = TMP102_Async_Poll(Bus, Count);
+      // A resumed coroutine may have queued on an adapter the poll had passed
+      if (Waiting())
+      {
+        continue;
+      }
+      if (busy == 0)
+      {
+        return;
+      }
+      if (Idle)
+      {
+        Idle(IdleContext);
+      }
+    }
+  }
+
+private:
+  bool Waiting() const
+  {
+    for (uint16_t i = 0; i < Count; i++)
+    {
+      if (!Bus[i]->Owner && Bus[i]->Head)
+      {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  TMP102_AsyncBus *const *Bus;
+  uint16_t Count;
+  void (*Idle)(void *context);
+  void *IdleContext;
+};
+
+}	// namespace tmp102
+
+#endif /* __TMP102_ASYNC_HPP */
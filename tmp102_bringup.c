@@ -0,0 +1,128 @@
+/**
+  ******************************************************************************
+  * @file    tmp102_bringup.c
+  * @author  Ngonidzashe Gwata
+  * @version V1.1.1
+  * @date    18-October-2026
+  * @brief   This file provides a start-up routine that brings every TMP102
+  *          on the bus to a stored configuration with as few transfers as
+  *          possible.
+  *          Each address is probed by reading CONFIG, T_LOW and T_HIGH in a
+  *          single sequence; an absent sensor NACKs the first pointer write
+  *          and the bus layer gives up at once instead of waiting out its
+  *          timeout. Only registers that differ from the image are written,
+  *          so after a watchdog reset a sensor that kept its configuration
+  *          costs six transfers and one pointer restore, and the first
+  *          readTempC can follow immediately.
+  ******************************************************************************
+ */
+
+#include "tmp102_bringup.h"
+
+static const uint8_t BringUpAddress[TMP102_BRINGUP_DEVICES] =
+{
+  TMP102_ADDR_GND, TMP102_ADDR_VCC, TMP102_ADDR_SDA, TMP102_ADDR_SCL
+};
+
+/**
+  * @brief  Read CONFIG, T_LOW and T_HIGH of one sensor.
+  * @param  Value: receives the three register values in that order.
+  * @retval ERROR if the sensor did not answer.
+  * @Note 	The pointer register is left on T_HIGH.
+  */
+static ErrorStatus BringUp_Read(uint8_t Address, uint16_t *Value)
+{
+  TMP102_BusStep steps[6];
+  uint8_t pointer[3];
+  uint8_t registerByte[6];
+  uint8_t i;
+
+  for (i = 0; i < 3; i++)
+  {
+    pointer[i] = CONFIG_REGISTER + i;	// CONFIG, T_LOW, T_HIGH
+    TMP102_SetStep(&steps[2*i], Address, &pointer[i], 1);
+    TMP102_SetStep(&steps[2*i + 1], Address | TMP102_BUS_READ, &registerByte[2*i], 2);
+  }
+  if (TMP102_Transfer(steps, 6) != SUCCESS)
+  {
+    return ERROR;
+  }
+  for (i = 0; i < 3; i++)
+  {
+    Value[i] = (uint16_t)((registerByte[2*i] << 8) | registerByte[2*i + 1]);
+  }
+  return SUCCESS;
+}
+
+/**
+  * @brief  Probe TMP102_ADDR_GND to TMP102_ADDR_SCL and restore each sensor found.
+  * @param  Image: TMP102_BRINGUP_DEVICES images, indexed like the return bits.
+  * @param  Programmed: if not 0, receives a bit per sensor that needed a write
+  *         and took it.
+  * @param  Failed: if not 0, receives a bit per sensor that answered the probe
+  *         but not the restore; its registers and pointer are then unknown and
+  *         it should be brought up again before use.
+  * @retval a bit per sensor that answered.
+  * @Note 	Every sensor found and not Failed is left with its pointer on the
+  *         temperature register.
+  */
+uint8_t TMP102_BringUp(const TMP102_ConfigImage *Image, uint8_t *Programmed,
+                       uint8_t *Failed)
+{
+  TMP102_BusStep steps[4];
+  uint8_t registerByte[10];
+  uint16_t current[3], wanted[3];
+  uint8_t present = 0, written = 0, failed = 0;
+  uint8_t dev, i, n, address;
+
+  for (dev = 0; dev < TMP102_BRINGUP_DEVICES; dev++)
+  {
+    address = BringUpAddress[dev];
+    if (BringUp_Read(address, current) != SUCCESS)
+    {
+      continue;
+    }
+    present |= (uint8_t)(1 << dev);
+
+    current[0] &= TMP102_CONFIG_WRITABLE;
+    wanted[0] = Image[dev].Config & TMP102_CONFIG_WRITABLE;
+    wanted[1] = Image[dev].TLow;
+    wanted[2] = Image[dev].THigh;
+
+    // CONFIG first so EM is right before the thresholds that depend on it
+    n = 0;
+    for (i = 0; i < 3; i++)
+    {
+      if (current[i] != wanted[i])
+      {
+        registerByte[3*n] = CONFIG_REGISTER + i;
+        registerByte[3*n + 1] = (uint8_t)(wanted[i] >> 8);
+        registerByte[3*n + 2] = (uint8_t)wanted[i];
+        TMP102_SetStep(&steps[n], address, &registerByte[3*n], 3);
+        n++;
+      }
+    }
+
+    //point to temperature register
+    registerByte[9] = TEMPERATURE_REGISTER;
+    TMP102_SetStep(&steps[n], address, &registerByte[9], 1);
+    if (TMP102_Transfer(steps, (uint8_t)(n + 1)) != SUCCESS)
+    {
+      failed |= (uint8_t)(1 << dev);
+    }
+    else if (n)
+    {
+      written |= (uint8_t)(1 << dev);
+    }
+  }
+
+  if (Programmed)
+  {
+    *Programmed = written;
+  }
+  if (Failed)
+  {
+    *Failed = failed;
+  }
+  return present;
+}
@@ -0,0 +1,45 @@
+/**
+  ******************************************************************************
+  * @file    tmp102_bringup.h
+  * @author  Ngonidzashe Gwata
+  * @version V1.1.1
+  * @date    18-October-2026
+  * @brief   This file contains all the functions prototypes for the
+  *          TMP102 start-up probe and configuration restore.
+  ******************************************************************************
+  *
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __TMP102_BRINGUP_H
+#define __TMP102_BRINGUP_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "tmp102_i2c.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/**
+  * @brief  Register values a sensor should hold, as they read back.
+  *         Build T_LOW/T_HIGH with TMP102_CountsToReg using the EM bit of Config.
+  */
+typedef struct
+{
+  uint16_t Config;	/*!< Only the TMP102_CONFIG_WRITABLE bits are compared and written */
+  uint16_t TLow;
+  uint16_t THigh;
+} TMP102_ConfigImage;
+
+/* Private define ------------------------------------------------------------*/
+#define TMP102_CONFIG_WRITABLE	0x1FD0	/*!< F1/F0, POL, TM, SD, CR1/CR0, EM */
+#define TMP102_BRINGUP_DEVICES	4		/*!< TMP102_ADDR_GND, _VCC, _SDA, _SCL */
+
+/* Private macro -------------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+	// Probe all four addresses and restore each present sensor to its image,
+	// returns a bit per present sensor (bit 0 for TMP102_ADDR_GND ... bit 3 for _SCL)
+	uint8_t TMP102_BringUp(const TMP102_ConfigImage *Image, uint8_t *Programmed,
+	                       uint8_t *Failed);
+
+#endif /* __TMP102_BRINGUP_H */
@@ -0,0 +1,81 @@
+/**
+  ******************************************************************************
+  * @file    tmp102_bus.h
+  * @author  Ngonidzashe Gwata
+  * @version V1.1.1
+  * @date    18-October-2026
+  * @brief   This file contains the transport functions the tmp102_i2c driver
+  *          runs over. One backend is linked in, each file building only
+  *          when its flag is defined:
+  *            - tmp102_bus_hw.c   TMP102_I2C peripheral through the SPL,
+  *                                TMP102_BUS_HW, defined here when no other
+  *                                backend is
+  *            - tmp102_bus_soft.c bit-banged GPIO master, define TMP102_BUS_SOFT
+  *            - tmp102_replay.c   captured log played back on a host, define
+  *                                TMP102_BUS_REPLAY
+  *            - tmp102_bus_sim.c  simulated sensors on a host, define
+  *                                TMP102_BUS_SIM
+  *          Defining TMP102_BUS_CAPTURE as well records every transfer of the
+  *          backend, see tmp102_capture.c.
+  ******************************************************************************
+  *
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __TMP102_BUS_H
+#define __TMP102_BUS_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm8l15x.h"
+#include "config.h"
+#include "tmp102_soft_timing.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/**
+  * @brief  One START...STOP transfer of a multi-step bus sequence
+  */
+typedef struct
+{
+  uint8_t Address;		/*!< Slave address, TMP102_BUS_READ set for a read */
+  uint8_t NumByte;
+  uint8_t *pBuffer;
+} TMP102_BusStep;
+
+/* Private define ------------------------------------------------------------*/
+#define TMP102_BUS_READ		0x01	/*!< R/W bit of the address byte */
+
+/* The peripheral backend is the default, any other backend replaces it */
+#if !defined(TMP102_BUS_SOFT) && !defined(TMP102_BUS_REPLAY) && !defined(TMP102_BUS_SIM)
+#define TMP102_BUS_HW
+#endif
+
+/* Backend entry points, wrapped by tmp102_capture.c when capturing */
+#ifdef TMP102_BUS_CAPTURE
+#define TMP102_BUS_WRITE_FN	TMP102_Bus_BackendWrite
+#define TMP102_BUS_READ_FN	TMP102_Bus_BackendRead
+	ErrorStatus TMP102_Bus_BackendWrite(uint8_t Address, const uint8_t *pBuffer, uint8_t NumByte);
+	ErrorStatus TMP102_Bus_BackendRead(uint8_t Address, uint8_t *pBuffer, uint8_t NumByte);
+#else
+#define TMP102_BUS_WRITE_FN	TMP102_Bus_Write
+#define TMP102_BUS_READ_FN	TMP102_Bus_Read
+#endif
+
+#define TMP102_SOFT_STRETCH_TIMEOUT	(uint16_t)0xFFFF	/*!< SCL polls while a slave stretches the clock */
+
+/* Private macro -------------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+	// Write NumByte bytes to a slave, NumByte 0 only checks that it acknowledges
+	ErrorStatus TMP102_Bus_Write(uint8_t Address, const uint8_t *pBuffer, uint8_t NumByte);
+
+	// Read NumByte (1 or more) bytes from a slave
+	ErrorStatus TMP102_Bus_Read(uint8_t Address, uint8_t *pBuffer, uint8_t NumByte);
+
+	// Software master only: configure the pins and the bit timing for BitRate (Hz)
+	ErrorStatus TMP102_Soft_Init(uint32_t BitRate);
+
+	// Software master only: force the delay loop counts, see tmp102_soft_timing.c
+	void TMP102_Soft_SetTiming(const TMP102_SoftTiming *Timing);
+
+#endif /* __TMP102_BUS_H */
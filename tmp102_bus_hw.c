@@ -0,0 +1,142 @@
+/**
+  ******************************************************************************
+  * @file    tmp102_bus_hw.c
+  * @author  Ngonidzashe Gwata
+  * @version V1.1.1
+  * @date    18-October-2026
+  * @brief   This file provides the TMP102 transport over the TMP102_I2C
+  *          peripheral, using the SPL event API. The peripheral itself is
+  *          initialised by i2c config() in config.c.
+  ******************************************************************************
+ */
+
+#include "tmp102_i2c.h"
+
+#ifdef TMP102_BUS_HW
+
+/**
+  * @brief  Wait for an I2C event, giving up on timeout or when the slave NACKs.
+  * @param  I2C_Event: event to wait for.
+  * @retval SUCCESS once the event occurred.
+  */
+static ErrorStatus Hw_WaitEvent(I2C_Event_TypeDef I2C_Event)
+{
+  uint32_t I2C_TimeOut = I2C_TIMEOUT;
+
+  while (!I2C_CheckEvent(TMP102_I2C, I2C_Event))
+  {
+    if ((I2C_GetFlagStatus(TMP102_I2C, I2C_FLAG_AF) != RESET) || (--I2C_TimeOut == 0))
+    {
+      I2C_ClearFlag(TMP102_I2C, I2C_FLAG_AF);
+      /* Send TMP102_I2C STOP Condition */
+      I2C_GenerateSTOP(TMP102_I2C, ENABLE);
+      return ERROR;
+    }
+  }
+  return SUCCESS;
+}
+
+/**
+  * @brief  Send a START condition and the slave address.
+  */
+static ErrorStatus Hw_Start(uint8_t Address)
+{
+  /* Clear the TMP102_I2C AF flag */
+  I2C_ClearFlag(TMP102_I2C, I2C_FLAG_AF);
+
+  /* Enable TMP102_I2C acknowledgement if it is already disabled by other function */
+  I2C_AcknowledgeConfig(TMP102_I2C, ENABLE);
+
+  /* Send TMP102_I2C START condition */
+  I2C_GenerateSTART(TMP102_I2C, ENABLE);
+
+  /* Test on TMP102_I2C EV5 and clear it */
+  if (Hw_WaitEvent(I2C_EVENT_MASTER_MODE_SELECT) != SUCCESS)  /* EV5 */
+  {
+    return ERROR;
+  }
+
+  if (Address & TMP102_BUS_READ)
+  {
+    I2C_Send7bitAddress(TMP102_I2C, Address & 0xFE, I2C_Direction_Receiver);
+    return Hw_WaitEvent(I2C_EVENT_MASTER_RECEIVER_MODE_SELECTED);  /* EV6 */
+  }
+  I2C_Send7bitAddress(TMP102_I2C, Address, I2C_Direction_Transmitter);
+  return Hw_WaitEvent(I2C_EVENT_MASTER_TRANSMITTER_MODE_SELECTED);  /* EV6 */
+}
+
+/**
+  * @brief  Write bytes to a slave.
+  * @param  Address: slave address, shifted left as TMP102_ADDR.
+  * @param  pBuffer: bytes to send.
+  * @param  NumByte: number of bytes, 0 to only check that the slave acknowledges.
+  * @retval SUCCESS if the slave acknowledged every byte.
+  */
+ErrorStatus TMP102_BUS_WRITE_FN(uint8_t Address, const uint8_t *pBuffer, uint8_t NumByte)
+{
+  if (Hw_Start(Address & 0xFE) != SUCCESS)
+  {
+    return ERROR;
+  }
+
+  while (NumByte--)
+  {
+    I2C_SendData(TMP102_I2C, *pBuffer++);
+
+    /* Test on TMP102_I2C EV8 and clear it */
+    if (Hw_WaitEvent(I2C_EVENT_MASTER_BYTE_TRANSMITTED) != SUCCESS)  /* EV8 */
+    {
+      return ERROR;
+    }
+  }
+
+  /* Send TMP102_I2C STOP Condition */
+  I2C_GenerateSTOP(TMP102_I2C, ENABLE);
+  return SUCCESS;
+}
+
+/**
+  * @brief  Read bytes from a slave.
+  * @param  Address: slave address, shifted left as TMP102_ADDR.
+  * @param  pBuffer: where to store the bytes.
+  * @param  NumByte: number of bytes, at least 1.
+  * @retval SUCCESS if every byte was received.
+  * @Note 	The last byte is NACKed the way the TMP102 two byte read needs, longer
+  *         reads on this peripheral need the POS/BTF sequence instead.
+  */
+ErrorStatus TMP102_BUS_READ_FN(uint8_t Address, uint8_t *pBuffer, uint8_t NumByte)
+{
+  uint32_t I2C_TimeOut = I2C_TIMEOUT;
+
+  if (Hw_Start(Address | TMP102_BUS_READ) != SUCCESS)
+  {
+    return ERROR;
+  }
+
+  while (NumByte-- > 1)
+  {
+    /* Test on EV7 and clear it */
+    if (Hw_WaitEvent(I2C_EVENT_MASTER_BYTE_RECEIVED) != SUCCESS)  /* EV7 */
+    {
+      return ERROR;
+    }
+    *pBuffer++ = I2C_ReceiveData(TMP102_I2C);
+  }
+
+  /* NACK the last byte and close communication */
+  I2C_AcknowledgeConfig(TMP102_I2C, DISABLE);
+  I2C_GenerateSTOP(TMP102_I2C, ENABLE);
+
+  /* Test on RXNE flag */
+  while (I2C_GetFlagStatus(TMP102_I2C, I2C_FLAG_RXNE) == RESET)
+  {
+    if (--I2C_TimeOut == 0)
+    {
+      return ERROR;
+    }
+  }
+  *pBuffer = I2C_ReceiveData(TMP102_I2C);
+  return SUCCESS;
+}
+
+#endif /* TMP102_BUS_HW */
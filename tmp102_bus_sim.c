@@ -0,0 +1,303 @@
+/**
+  ******************************************************************************
+  * @file    tmp102_bus_sim.c
+  * @author  Ngonidzashe Gwata
+  * @version V1.1.1
+  * @date    18-October-2026
+  * @brief   This file provides a simulated I2C bus of TMP102 sensors for
+  *          Linux hosts, built with host/ first on the include path.
+  *          Each TMP102_SimBus models its sensors' registers, pointer and
+  *          one-shot conversions, and times every unit by the bits it puts
+  *          on the wire at BitRate, so code waiting on it sees real bus and
+  *          conversion latencies without hardware.
+  *          A unit's effects are applied when it is put on the bus; only
+  *          its completion is held back until the wire time has passed. An
+  *          absent address NACKs and ends the unit, as TMP102_Transfer does.
+  *          Sensor k answers at 0x90 + 2*k; a real bus reaches more than
+  *          four sensors through a multiplexer.
+  *          Defining TMP102_BUS_SIM also makes this file the driver's bus
+  *          backend, running on the bus given to TMP102_Sim_Attach.
+  ******************************************************************************
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include "tmp102_bus_sim.h"
+#include "tmp102_arbiter.h"
+
+#include <string.h>
+#include <time.h>
+
+#define SIM_CONFIG_WRITABLE	0x1FD0	/* F1/F0, POL, TM, SD, CR1/CR0, EM */
+#define SIM_CONFIG_OS		0x8000
+#define SIM_CONFIG_SD		0x0100
+
+uint64_t TMP102_Sim_Now(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static void Sim_Sleep(uint64_t until)
+{
+  struct timespec ts;
+
+  ts.tv_sec = (time_t)(until / 1000000000ULL);
+  ts.tv_nsec = (long)(until % 1000000000ULL);
+  while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, 0) != 0)
+  {
+  }
+}
+
+static void Sim_PowerUp(TMP102_SimSensor *sensor)
+{
+  sensor->Reg[TEMPERATURE_REGISTER] = (uint16_t)((uint16_t)(sensor->Base + sensor->Conversions) << 4);
+  sensor->Reg[CONFIG_REGISTER] = 0x60A0;
+  sensor->Reg[T_LOW_REGISTER] = 0x4B00;
+  sensor->Reg[T_HIGH_REGISTER] = 0x5000;
+  sensor->Pointer = TEMPERATURE_REGISTER;
+  sensor->Converting = 0;
+}
+
+/**
+  * @brief  Power up a bus of sensors.
+  * @param  sensors: 1 to TMP102_SIM_MAX_SENSORS, sensor k at address 0x90 + 2*k.
+  * @param  BitRate: SCL frequency in Hz.
+  * @param  base: temperature of sensor 0 in 1/16 C, sensor k reads base + k.
+  * @retval None
+  */
+void TMP102_Sim_Init(TMP102_SimBus *bus, uint8_t sensors, uint32_t BitRate, int16_t base)
+{
+  uint8_t k;
+
+  memset(bus, 0, sizeof(*bus));
+  bus->Sensors = (sensors > TMP102_SIM_MAX_SENSORS) ? TMP102_SIM_MAX_SENSORS : sensors;
+  bus->BitRate = BitRate;
+  for (k = 0; k < bus->Sensors; k++)
+  {
+    bus->Sensor[k].Base = (int16_t)(base + k);
+    Sim_PowerUp(&bus->Sensor[k]);
+  }
+}
+
+/**
+  * @brief  Finish a one-shot whose conversion time has passed.
+  */
+static void Sim_Update(TMP102_SimSensor *sensor, uint64_t now)
+{
+  if (sensor->Converting && now >= sensor->Ready)
+  {
+    sensor->Converting = 0;
+    sensor->Conversions++;
+    sensor->Reg[TEMPERATURE_REGISTER] =
+      (uint16_t)((uint16_t)(sensor->Base + sensor->Conversions) << 4);
+  }
+}
+
+static TMP102_SimSensor *Sim_Find(TMP102_SimBus *bus, uint8_t Address)
+{
+  uint8_t k;
+
+  Address &= (uint8_t)~TMP102_BUS_READ;
+  if (Address < 0x90)
+  {
+    return 0;
+  }
+  k = (uint8_t)((Address - 0x90) >> 1);
+  return (k < bus->Sensors) ? &bus->Sensor[k] : 0;
+}
+
+/**
+  * @brief  Apply one START...STOP transfer to the sensors.
+  * @param  bits: increased by the bits it put on the wire.
+  * @retval ERROR if nobody acknowledged the address.
+  */
+static ErrorStatus Sim_Step(TMP102_SimBus *bus, const TMP102_BusStep *step, uint64_t now,
+                            uint32_t *bits)
+{
+  TMP102_SimSensor *sensor = Sim_Find(bus, step->Address);
+  uint16_t value, config;
+  uint8_t i, k;
+
+  bus->Transfers++;
+  *bits += 9 + 2;	// address byte with its ACK, START and STOP
+  if (step->Address == 0x00)
+  {
+    // General call, reset command resets every sensor
+    *bits += 9 * (uint32_t)step->NumByte;
+    if (step->NumByte && step->pBuffer[0] == 0x06)
+    {
+      for (k = 0; k < bus->Sensors; k++)
+      {
+        Sim_PowerUp(&bus->Sensor[k]);
+      }
+    }
+    return SUCCESS;
+  }
+  if (sensor == 0)
+  {
+    return ERROR;
+  }
+  *bits += 9 * (uint32_t)step->NumByte;
+  Sim_Update(sensor, now);
+
+  if (step->Address & TMP102_BUS_READ)
+  {
+    value = sensor->Reg[sensor->Pointer];
+    if (sensor->Pointer == CONFIG_REGISTER)
+    {
+      // OS reads 1 in shutdown once no conversion is running
+      config = value & (uint16_t)~SIM_CONFIG_OS;
+      value = ((value & SIM_CONFIG_SD) && !sensor->Converting) ? (config | SIM_CONFIG_OS) : config;
+    }
+    for (i = 0; i < step->NumByte; i++)
+    {
+      step->pBuffer[i] = (uint8_t)((i & 1) ? value : value >> 8);
+    }
+    return SUCCESS;
+  }
+
+  if (step->NumByte >= 1)
+  {
+    sensor->Pointer = step->pBuffer[0] & 0x03;
+  }
+  if (step->NumByte >= 3)
+  {
+    value = (uint16_t)((step->pBuffer[1] << 8) | step->pBuffer[2]);
+    switch (sensor->Pointer)
+    {
+    case CONFIG_REGISTER:
+      config = sensor->Reg[CONFIG_REGISTER];
+      config = (uint16_t)((config & ~SIM_CONFIG_WRITABLE) | (value & SIM_CONFIG_WRITABLE));
+      sensor->Reg[CONFIG_REGISTER] = config;
+      if ((value & SIM_CONFIG_OS) && (config & SIM_CONFIG_SD) && !sensor->Converting)
+      {
+        sensor->Converting = 1;
+        sensor->Ready = now + TMP102_SIM_CONVERSION;
+      }
+      break;
+    case T_LOW_REGISTER:
+    case T_HIGH_REGISTER:
+      sensor->Reg[sensor->Pointer] = value & 0xFFF0;
+      break;
+    default:	// temperature register is read only
+      break;
+    }
+  }
+  return SUCCESS;
+}
+
+/**
+  * @brief  Put a unit on the bus without waiting for it.
+  * @param  Port: the TMP102_SimBus.
+  * @retval ERROR if a unit is already on the bus.
+  */
+ErrorStatus TMP102_Sim_Begin(void *Port, TMP102_BusStep *Steps, uint8_t NumStep)
+{
+  TMP102_SimBus *bus = (TMP102_SimBus *)Port;
+  uint64_t now = TMP102_Sim_Now();
+  ErrorStatus status = SUCCESS;
+  uint32_t bits = 0;
+
+  if (bus->Busy)
+  {
+    return ERROR;
+  }
+  while (status == SUCCESS && NumStep--)
+  {
+    status = Sim_Step(bus, Steps++, now, &bits);
+  }
+  bus->Busy = 1;
+  bus->Result = (status == SUCCESS) ? TMP102_ARB_DONE : TMP102_ARB_ERROR;
+  bus->Until = now + (uint64_t)bits * 1000000000ULL / bus->BitRate;
+  return SUCCESS;
+}
+
+/**
+  * @brief  State of the unit started by TMP102_Sim_Begin.
+  * @param  Port: the TMP102_SimBus.
+  * @retval TMP102_ARB_RUNNING until its wire time has passed, then its result.
+  */
+uint8_t TMP102_Sim_Check(void *Port)
+{
+  TMP102_SimBus *bus = (TMP102_SimBus *)Port;
+
+  if (bus->Busy && TMP102_Sim_Now() < bus->Until)
+  {
+    return TMP102_ARB_RUNNING;
+  }
+  bus->Busy = 0;
+  return bus->Result;
+}
+
+/**
+  * @brief  Run a unit, sleeping until the bus would have finished it.
+  * @retval SUCCESS if every transfer was acknowledged.
+  */
+ErrorStatus TMP102_Sim_Transfer(TMP102_SimBus *bus, TMP102_BusStep *Steps, uint8_t NumStep)
+{
+  if (TMP102_Sim_Begin(bus, Steps, NumStep) != SUCCESS)
+  {
+    return ERROR;
+  }
+  Sim_Sleep(bus->Until);
+  return (TMP102_Sim_Check(bus) == TMP102_ARB_DONE) ? SUCCESS : ERROR;
+}
+
+/**
+  * @brief  Sleep until the earliest unit on the given buses ends.
+  * @retval None
+  */
+void TMP102_Sim_Wait(TMP102_SimBus *const *bus, uint16_t count)
+{
+  uint64_t until = 0;
+  uint16_t i;
+
+  for (i = 0; i < count; i++)
+  {
+    if (bus[i]->Busy && (until == 0 || bus[i]->Until < until))
+    {
+      until = bus[i]->Until;
+    }
+  }
+  if (until)
+  {
+    Sim_Sleep(until);
+  }
+}
+
+#ifdef TMP102_BUS_SIM
+
+static TMP102_SimBus *Attached;
+
+/**
+  * @brief  Select the bus the driver's transfers run on.
+  */
+void TMP102_Sim_Attach(TMP102_SimBus *bus)
+{
+  Attached = bus;
+}
+
+ErrorStatus TMP102_BUS_WRITE_FN(uint8_t Address, const uint8_t *pBuffer, uint8_t NumByte)
+{
+  TMP102_BusStep step;
+
+  step.Address = Address & (uint8_t)~TMP102_BUS_READ;
+  step.pBuffer = (uint8_t *)pBuffer;
+  step.NumByte = NumByte;
+  return Attached ? TMP102_Sim_Transfer(Attached, &step, 1) : ERROR;
+}
+
+ErrorStatus TMP102_BUS_READ_FN(uint8_t Address, uint8_t *pBuffer, uint8_t NumByte)
+{
+  TMP102_BusStep step;
+
+  step.Address = Address | TMP102_BUS_READ;
+  step.pBuffer = pBuffer;
+  step.NumByte = NumByte;
+  return Attached ? TMP102_Sim_Transfer(Attached, &step, 1) : ERROR;
+}
+
+#endif /* TMP102_BUS_SIM */
@@ -0,0 +1,75 @@
+/**
+  ******************************************************************************
+  * @file    tmp102_bus_sim.h
+  * @author  Ngonidzashe Gwata
+  * @version V1.1.1
+  * @date    18-October-2026
+  * @brief   This file contains all the functions prototypes for the
+  *          simulated TMP102 bus used on Linux hosts.
+  ******************************************************************************
+  *
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __TMP102_BUS_SIM_H
+#define __TMP102_BUS_SIM_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "tmp102_i2c.h"
+
+/* Private define ------------------------------------------------------------*/
+#define TMP102_SIM_MAX_SENSORS	32			/*!< Sensors at 0x90, 0x92 ... 0xCE */
+#define TMP102_SIM_CONVERSION	26000000UL	/*!< One-shot conversion time, ns (26 ms typical) */
+
+/* Private typedef -----------------------------------------------------------*/
+/**
+  * @brief  Model of one sensor. TEMP holds Base plus one count per
+  *         completed one-shot conversion, so every result can be checked.
+  */
+typedef struct
+{
+  uint64_t Ready;		/*!< When the running one-shot completes, ns */
+  uint16_t Reg[4];		/*!< TEMP, CONFIG, T_LOW, T_HIGH */
+  int16_t Base;			/*!< Temperature in 1/16 C before any one-shot */
+  uint16_t Conversions;	/*!< One-shots completed */
+  uint8_t Pointer;
+  uint8_t Converting;
+} TMP102_SimSensor;
+
+/**
+  * @brief  One simulated bus. A unit of steps takes the time its bits take
+  *         at BitRate, and only one unit is on the bus at a time.
+  */
+typedef struct
+{
+  TMP102_SimSensor Sensor[TMP102_SIM_MAX_SENSORS];
+  uint64_t Until;		/*!< When the unit on the bus ends, ns */
+  uint32_t BitRate;		/*!< Hz */
+  uint32_t Transfers;	/*!< START...STOP transfers put on the bus */
+  uint8_t Sensors;
+  uint8_t Busy;			/*!< A unit is on the bus */
+  uint8_t Result;		/*!< TMP102_ARB_DONE or TMP102_ARB_ERROR once it ends */
+} TMP102_SimBus;
+
+/* Private macro -------------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+	// Power up sensors (1 - TMP102_SIM_MAX_SENSORS) reading base + 1/16 C per sensor index
+	void TMP102_Sim_Init(TMP102_SimBus *bus, uint8_t sensors, uint32_t BitRate, int16_t base);
+	uint64_t TMP102_Sim_Now(void);	// Monotonic time, ns
+
+	// Adapter transport for tmp102_async.c, Port is the TMP102_SimBus
+	ErrorStatus TMP102_Sim_Begin(void *Port, TMP102_BusStep *Steps, uint8_t NumStep);
+	uint8_t TMP102_Sim_Check(void *Port);
+
+	// Run a unit and sleep until it ends, as a blocking driver would
+	ErrorStatus TMP102_Sim_Transfer(TMP102_SimBus *bus, TMP102_BusStep *Steps, uint8_t NumStep);
+
+	// Sleep until the first unit on any of the buses ends, returns at once if none is busy
+	void TMP102_Sim_Wait(TMP102_SimBus *const *bus, uint16_t count);
+
+	// With TMP102_BUS_SIM the driver's TMP102_Bus_Write/Read run on this bus
+	void TMP102_Sim_Attach(TMP102_SimBus *bus);
+
+#endif /* __TMP102_BUS_SIM_H */
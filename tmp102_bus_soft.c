@@ -0,0 +1,228 @@
+/**
+  ******************************************************************************
+  * @file    tmp102_bus_soft.c
+  * @author  Ngonidzashe Gwata
+  * @version V1.1.1
+  * @date    18-October-2026
+  * @brief   This file provides the TMP102 transport as a bit-banged I2C
+  *          master, for boards where the sensor is not on an I2C peripheral.
+  *          Define TMP102_BUS_SOFT and set TMP102_SCL_GPIO_PORT/TMP102_SCL_PIN
+  *          and TMP102_SDA_GPIO_PORT/TMP102_SDA_PIN in config.h.
+  *
+  *          Both lines are open drain: writing 1 releases the line, so a
+  *          slave stretching the clock simply holds SCL low and the master
+  *          waits for it to read high before timing the high phase.
+  *
+  *          The bit timing comes from TMP102_Soft_ComputeTiming() in
+  *          tmp102_soft_timing.c, a pure model of the cycles spent in each
+  *          phase that tools/tmp102_softcheck.c checks on a host against the
+  *          standard and fast mode minimums. SCL low, SCL high and the
+  *          START/STOP setup phases each have their own cycle overhead, see
+  *          the TMP102_SOFT_xx_OVERHEAD values.
+  ******************************************************************************
+ */
+
+#include "tmp102_bus.h"
+
+#ifdef TMP102_BUS_SOFT
+
+#define SCL_RELEASE()	GPIO_SetBits(TMP102_SCL_GPIO_PORT, TMP102_SCL_PIN)
+#define SCL_LOW()		GPIO_ResetBits(TMP102_SCL_GPIO_PORT, TMP102_SCL_PIN)
+#define SDA_RELEASE()	GPIO_SetBits(TMP102_SDA_GPIO_PORT, TMP102_SDA_PIN)
+#define SDA_LOW()		GPIO_ResetBits(TMP102_SDA_GPIO_PORT, TMP102_SDA_PIN)
+#define SCL_READ()		GPIO_ReadInputDataBit(TMP102_SCL_GPIO_PORT, TMP102_SCL_PIN)
+#define SDA_READ()		GPIO_ReadInputDataBit(TMP102_SDA_GPIO_PORT, TMP102_SDA_PIN)
+
+static TMP102_SoftTiming SoftTiming;
+
+static void Soft_Delay(uint16_t loops)
+{
+  __IO uint16_t count = loops;
+
+  while (count--)
+  {
+  }
+}
+
+/**
+  * @brief  Release SCL and wait until it reads high, a slave may stretch it.
+  */
+static ErrorStatus Soft_SclHigh(void)
+{
+  uint16_t TimeOut = TMP102_SOFT_STRETCH_TIMEOUT;
+
+  SCL_RELEASE();
+  while (SCL_READ() == RESET)
+  {
+    if (--TimeOut == 0)
+    {
+      return ERROR;
+    }
+  }
+  return SUCCESS;
+}
+
+/**
+  * @brief  Clock one bit, SCL is low on entry and on return.
+  * @param  bit: bit to send, 1 to release SDA when receiving.
+  * @retval level of SDA sampled while SCL was high, 0xFF on stretch timeout.
+  */
+static uint8_t Soft_Bit(uint8_t bit)
+{
+  uint8_t level;
+
+  if (bit)
+  {
+    SDA_RELEASE();
+  }
+  else
+  {
+    SDA_LOW();
+  }
+  Soft_Delay(SoftTiming.Low);		/* tLOW, covers tSU;DAT */
+  if (Soft_SclHigh() != SUCCESS)
+  {
+    return 0xFF;
+  }
+  Soft_Delay(SoftTiming.High);		/* tHIGH */
+  level = (SDA_READ() != RESET);
+  SCL_LOW();
+  return level;
+}
+
+static ErrorStatus Soft_Start(void)
+{
+  /* Repeated start: SCL may be low, bring both lines up first */
+  SDA_RELEASE();
+  if (Soft_SclHigh() != SUCCESS)
+  {
+    return ERROR;
+  }
+  Soft_Delay(SoftTiming.Setup);		/* tSU;STA */
+  SDA_LOW();
+  Soft_Delay(SoftTiming.Setup);		/* tHD;STA */
+  SCL_LOW();
+  return SUCCESS;
+}
+
+static void Soft_Stop(void)
+{
+  SDA_LOW();
+  Soft_Delay(SoftTiming.Low);
+  Soft_SclHigh();
+  Soft_Delay(SoftTiming.Setup);		/* tSU;STO */
+  SDA_RELEASE();
+  Soft_Delay(SoftTiming.Low);		/* tBUF */
+}
+
+/**
+  * @brief  Send a byte MSB first.
+  * @retval SUCCESS if the slave acknowledged it.
+  */
+static ErrorStatus Soft_WriteByte(uint8_t data)
+{
+  uint8_t i;
+
+  for (i = 0; i < 8; i++)
+  {
+    if (Soft_Bit(data & 0x80) == 0xFF)
+    {
+      return ERROR;
+    }
+    data <<= 1;
+  }
+  return (Soft_Bit(1) == 0) ? SUCCESS : ERROR;	/* ACK is SDA held low */
+}
+
+/**
+  * @brief  Receive a byte MSB first and acknowledge it unless it is the last.
+  */
+static ErrorStatus Soft_ReadByte(uint8_t *data, bool last)
+{
+  uint8_t i, level, value = 0;
+
+  for (i = 0; i < 8; i++)
+  {
+    level = Soft_Bit(1);
+    if (level == 0xFF)
+    {
+      return ERROR;
+    }
+    value = (uint8_t)((value << 1) | level);
+  }
+  *data = value;
+  return (Soft_Bit(last) == 0xFF) ? ERROR : SUCCESS;
+}
+
+/**
+  * @brief  Configure both pins as open drain and compute the bit timing.
+  * @param  BitRate: SCL frequency in Hz, up to 400000.
+  * @retval ERROR if BitRate is out of range.
+  */
+ErrorStatus TMP102_Soft_Init(uint32_t BitRate)
+{
+  GPIO_Init(TMP102_SCL_GPIO_PORT, TMP102_SCL_PIN, GPIO_Mode_Out_OD_HiZ_Fast);
+  GPIO_Init(TMP102_SDA_GPIO_PORT, TMP102_SDA_PIN, GPIO_Mode_Out_OD_HiZ_Fast);
+  SCL_RELEASE();
+  SDA_RELEASE();
+  return TMP102_Soft_ComputeTiming(CLK_GetClockFreq(), BitRate, &SoftTiming) ? SUCCESS : ERROR;
+}
+
+/**
+  * @brief  Force the delay loop counts, for calibrating the cycle costs.
+  * @param  Timing: loop counts to use, the Cycles fields are ignored.
+  * @retval None
+  */
+void TMP102_Soft_SetTiming(const TMP102_SoftTiming *Timing)
+{
+  SoftTiming = *Timing;
+}
+
+/**
+  * @brief  Write bytes to a slave.
+  * @param  Address: slave address, shifted left as TMP102_ADDR.
+  * @param  pBuffer: bytes to send.
+  * @param  NumByte: number of bytes, 0 to only check that the slave acknowledges.
+  * @retval SUCCESS if the slave acknowledged every byte.
+  */
+ErrorStatus TMP102_BUS_WRITE_FN(uint8_t Address, const uint8_t *pBuffer, uint8_t NumByte)
+{
+  ErrorStatus status = Soft_Start();
+
+  if (status == SUCCESS)
+  {
+    status = Soft_WriteByte(Address & 0xFE);
+  }
+  while (status == SUCCESS && NumByte--)
+  {
+    status = Soft_WriteByte(*pBuffer++);
+  }
+  Soft_Stop();
+  return status;
+}
+
+/**
+  * @brief  Read bytes from a slave.
+  * @param  Address: slave address, shifted left as TMP102_ADDR.
+  * @param  pBuffer: where to store the bytes.
+  * @param  NumByte: number of bytes, at least 1.
+  * @retval SUCCESS if every byte was received.
+  */
+ErrorStatus TMP102_BUS_READ_FN(uint8_t Address, uint8_t *pBuffer, uint8_t NumByte)
+{
+  ErrorStatus status = Soft_Start();
+
+  if (status == SUCCESS)
+  {
+    status = Soft_WriteByte(Address | TMP102_BUS_READ);
+  }
+  while (status == SUCCESS && NumByte)
+  {
+    NumByte--;
+    status = Soft_ReadByte(pBuffer++, (bool)(NumByte == 0));
+  }
+  Soft_Stop();
+  return status;
+}
+
+#endif /* TMP102_BUS_SOFT */
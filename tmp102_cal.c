@@ -0,0 +1,60 @@
+/**
+  ******************************************************************************
+  * @file    tmp102_cal.c
+  * @author  Ngonidzashe Gwata
+  * @version V1.1.1
+  * @date    18-October-2026
+  * @brief   This file provides the per-device calibration stage. It works on
+  *          the raw 1/16 C counts from readTempRaw, before any rounding to
+  *          tenths or degrees, so a correction finer than the output unit is
+  *          not lost. Each sensor gets its own TMP102_Calibration, normally a
+  *          const table in flash, and the caller passes the one matching the
+  *          device it just read:
+  *            counts = TMP102_Cal_Apply(&Cal[n], readTempRaw());
+  *          TMP102_TEMP_INVALID from a failed read comes out unchanged, so
+  *          test for it before converting the result.
+  *          Breakpoints are a power of two apart so locating the segment is a
+  *          shift, and corrections are int8 so interpolating is one 8x8
+  *          multiply; there is no division and no float.
+  ******************************************************************************
+ */
+
+#include "tmp102_cal.h"
+
+/**
+  * @brief  Apply a sensor's correction to one reading.
+  * @param  Cal: calibration of the sensor that produced the reading.
+  * @param  counts: temperature in 1/16 C as returned by readTempRaw.
+  *         TMP102_TEMP_INVALID is returned unchanged, not corrected.
+  * @retval corrected temperature in 1/16 C.
+  */
+int16_t TMP102_Cal_Apply(const TMP102_Calibration *Cal, int16_t counts)
+{
+  const int8_t *table = Cal->Table;
+  uint8_t last = Cal->Points - 1;
+  int16_t position;
+  uint16_t index;
+  uint8_t fraction;
+  int16_t delta;
+
+  if (counts == TMP102_TEMP_INVALID)
+  {
+    return counts;
+  }
+  position = counts - Cal->Base;
+  if (position <= 0)
+  {
+    return counts + table[0];
+  }
+  index = (uint16_t)position >> Cal->Shift;
+  if (index >= last)
+  {
+    return counts + table[last];
+  }
+
+  fraction = (uint8_t)position & (uint8_t)((1 << Cal->Shift) - 1);
+  delta = table[index + 1] - table[index];
+  // |delta| <= 254 and fraction < 128, the product fits 16 bits; round to nearest
+  delta = (int16_t)(delta*fraction + ((1 << Cal->Shift) >> 1)) >> Cal->Shift;
+  return counts + table[index] + delta;
+}
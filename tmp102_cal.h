@@ -0,0 +1,47 @@
+/**
+  ******************************************************************************
+  * @file    tmp102_cal.h
+  * @author  Ngonidzashe Gwata
+  * @version V1.1.1
+  * @date    18-October-2026
+  * @brief   This file contains all the functions prototypes for the
+  *          per-device TMP102 calibration stage.
+  ******************************************************************************
+  *
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __TMP102_CAL_H
+#define __TMP102_CAL_H
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include "tmp102_codec.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/**
+  * @brief  Piecewise-linear correction of one sensor, in 1/16 C counts.
+  *         Table[k] is added to a reading of Base + k*2^Shift counts and
+  *         readings in between are interpolated. Below Base and above the
+  *         last breakpoint the end corrections hold. One point is a plain
+  *         offset; tools/tmp102_calfit.c fits tables from reference logs.
+  */
+typedef struct
+{
+  int16_t Base;			/*!< Reading of the first breakpoint, 1/16 C */
+  uint8_t Shift;		/*!< Breakpoints are 2^Shift counts apart, 0 to TMP102_CAL_MAX_SHIFT */
+  uint8_t Points;		/*!< Entries in Table, at least 1 */
+  const int8_t *Table;	/*!< Correction at each breakpoint, 1/16 C */
+} TMP102_Calibration;
+
+/* Private define ------------------------------------------------------------*/
+#define TMP102_CAL_MAX_SHIFT	7	/*!< Keeps the interpolation product within 16 bits */
+
+/* Private macro -------------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+	// Correct a reading from readTempRaw, the result is still in 1/16 C counts
+	int16_t TMP102_Cal_Apply(const TMP102_Calibration *Cal, int16_t counts);
+
+#endif /* __TMP102_CAL_H */
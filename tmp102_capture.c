@@ -0,0 +1,144 @@
+/**
+  ******************************************************************************
+  * @file    tmp102_capture.c
+  * @author  Ngonidzashe Gwata
+  * @version V1.1.1
+  * @date    18-October-2026
+  * @brief   This file records every transfer the driver puts on the bus.
+  *          Built with TMP102_BUS_CAPTURE it provides TMP102_Bus_Write and
+  *          TMP102_Bus_Read, passes each transfer to the backend and appends
+  *          a record to the log buffer. The first transfer that does not
+  *          fit ends the log, even if a later one would: every transfer
+  *          after it is only counted, in the header as well, so the log
+  *          stays one contiguous run that can be written out as a file and
+  *          replayed with tmp102_replay.c, which then knows where it stops.
+  ******************************************************************************
+ */
+
+#include "tmp102_capture.h"
+
+#ifdef TMP102_BUS_CAPTURE
+
+static uint8_t *LogBuffer;
+static uint16_t LogSize;
+static uint16_t LogLength;
+static uint16_t LogDropped;
+static bool LogFull;
+static uint32_t (*LogTick)(void);
+
+static void Capture_Put32(uint8_t *p, uint32_t value)
+{
+  p[0] = (uint8_t)value;
+  p[1] = (uint8_t)(value >> 8);
+  p[2] = (uint8_t)(value >> 16);
+  p[3] = (uint8_t)(value >> 24);
+}
+
+static void Capture_Record(uint32_t tick, uint8_t Address, ErrorStatus status,
+                           const uint8_t *pBuffer, uint8_t NumByte)
+{
+  uint8_t *p;
+
+  if (LogBuffer == 0)
+  {
+    return;
+  }
+  if (LogFull ||
+      (uint16_t)(LogSize - LogLength) < (uint16_t)(TMP102_CAPTURE_RECORD_SIZE + NumByte))
+  {
+    // Latch full so no later, smaller record follows the gap
+    LogFull = TRUE;
+    if (LogDropped != 0xFFFF)
+    {
+      LogDropped++;
+    }
+    LogBuffer[TMP102_CAPTURE_DROPPED] = (uint8_t)LogDropped;
+    LogBuffer[TMP102_CAPTURE_DROPPED + 1] = (uint8_t)(LogDropped >> 8);
+    return;
+  }
+
+  p = LogBuffer + LogLength;
+  Capture_Put32(p, tick);
+  p[4] = Address;
+  p[5] = (status == SUCCESS) ? TMP102_CAPTURE_ACK : 0;
+  p[6] = NumByte;
+  p += TMP102_CAPTURE_RECORD_SIZE;
+  LogLength += TMP102_CAPTURE_RECORD_SIZE + NumByte;
+  while (NumByte--)
+  {
+    *p++ = *pBuffer++;
+  }
+}
+
+/**
+  * @brief  Start a new log.
+  * @param  pBuffer: log storage, the header is written at once.
+  * @param  Size: storage size in bytes, at least TMP102_CAPTURE_HEADER_SIZE.
+  * @param  GetTick: free running tick source, may be 0.
+  * @param  TicksPerSecond: rate of GetTick, stored in the header for replay.
+  * @retval None
+  */
+void TMP102_Capture_Start(uint8_t *pBuffer, uint16_t Size,
+                          uint32_t (*GetTick)(void), uint32_t TicksPerSecond)
+{
+  LogBuffer = 0;
+  if (Size < TMP102_CAPTURE_HEADER_SIZE)
+  {
+    return;
+  }
+
+  pBuffer[0] = 'T';
+  pBuffer[1] = '1';
+  pBuffer[2] = '0';
+  pBuffer[3] = '2';
+  pBuffer[4] = TMP102_CAPTURE_VERSION;
+  pBuffer[5] = 0;
+  pBuffer[6] = 0;	// dropped transfers
+  pBuffer[7] = 0;
+  Capture_Put32(&pBuffer[8], TicksPerSecond);
+
+  LogSize = Size;
+  LogLength = TMP102_CAPTURE_HEADER_SIZE;
+  LogDropped = 0;
+  LogFull = FALSE;
+  LogTick = GetTick;
+  LogBuffer = pBuffer;
+}
+
+/**
+  * @brief  Stop recording, the buffer keeps the log.
+  */
+void TMP102_Capture_Stop(void)
+{
+  LogBuffer = 0;
+}
+
+uint16_t TMP102_Capture_Length(void)
+{
+  return LogLength;
+}
+
+uint16_t TMP102_Capture_Dropped(void)
+{
+  return LogDropped;
+}
+
+ErrorStatus TMP102_Bus_Write(uint8_t Address, const uint8_t *pBuffer, uint8_t NumByte)
+{
+  uint32_t tick = LogTick ? LogTick() : 0;
+  ErrorStatus status = TMP102_BUS_WRITE_FN(Address, pBuffer, NumByte);
+
+  Capture_Record(tick, Address & 0xFE, status, pBuffer, NumByte);
+  return status;
+}
+
+ErrorStatus TMP102_Bus_Read(uint8_t Address, uint8_t *pBuffer, uint8_t NumByte)
+{
+  uint32_t tick = LogTick ? LogTick() : 0;
+  ErrorStatus status = TMP102_BUS_READ_FN(Address, pBuffer, NumByte);
+
+  Capture_Record(tick, Address | TMP102_BUS_READ, status, pBuffer, NumByte);
+  return status;
+}
+
+#endif /* TMP102_BUS_CAPTURE */
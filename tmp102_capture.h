@@ -0,0 +1,52 @@
+/**
+  ******************************************************************************
+  * @file    tmp102_capture.h
+  * @author  Ngonidzashe Gwata
+  * @version V1.1.1
+  * @date    18-October-2026
+  * @brief   This file contains the bus capture log format and the functions
+  *          prototypes for recording it.
+  *
+  *          A log is a 12 byte header followed by one record per transfer,
+  *          all multi-byte fields little endian:
+  *            header: 'T' '1' '0' '2', version, 1 reserved byte,
+  *                    dropped transfers (uint16), ticks per second (uint32)
+  *            record: tick at the start of the transfer (uint32),
+  *                    address byte with the R/W bit, flags, length,
+  *                    then length bytes written or read
+  *          Flag TMP102_CAPTURE_ACK is set when the transfer succeeded,
+  *          clear when the slave NACKed or the bus timed out.
+  *          A non-zero dropped count marks a log cut short by a full
+  *          buffer: the unit made that many more transfers after the last
+  *          record.
+  ******************************************************************************
+  *
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __TMP102_CAPTURE_H
+#define __TMP102_CAPTURE_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "tmp102_bus.h"
+
+/* Private define ------------------------------------------------------------*/
+#define TMP102_CAPTURE_VERSION		1
+#define TMP102_CAPTURE_HEADER_SIZE	12
+#define TMP102_CAPTURE_RECORD_SIZE	7	/*!< Record size before the data bytes */
+#define TMP102_CAPTURE_DROPPED		6	/*!< Header offset of the dropped count */
+#define TMP102_CAPTURE_ACK			0x01
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+	// Start a log in buffer, GetTick stamps each transfer (TicksPerSecond per second)
+	void TMP102_Capture_Start(uint8_t *pBuffer, uint16_t Size,
+	                          uint32_t (*GetTick)(void), uint32_t TicksPerSecond);
+	void TMP102_Capture_Stop(void);
+	uint16_t TMP102_Capture_Length(void);	// Bytes of log in the buffer, header included
+	uint16_t TMP102_Capture_Dropped(void);	// Transfers made after the buffer filled, none recorded
+
+#endif /* __TMP102_CAPTURE_H */
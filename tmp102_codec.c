@@ -0,0 +1,98 @@
+/**
+  ******************************************************************************
+  * @file    tmp102_codec.c
+  * @author  Ngonidzashe Gwata
+  * @version V1.1.1
+  * @date    18-October-2026
+  * @brief   This file provides the conversions between TMP102 register
+  *          values, 1/16 C counts and output units. Every driver entry point
+  *          converts through these functions, and they depend on nothing but
+  *          stdint.h, so tools/tmp102_convcheck.c can check them on a host
+  *          against a reference model over every register code.
+  ******************************************************************************
+ */
+
+#include "tmp102_codec.h"
+
+/**
+  * @brief  Decode a temperature, T_LOW or T_HIGH register value.
+  * @param  RegValue: register value.
+  * @param  extended: 1 if the value is in 13 bit (extended mode) format.
+  * @retval temperature in 1/16 degrees celcius.
+  */
+int16_t TMP102_RegToCounts(uint16_t RegValue, uint8_t extended)
+{
+  uint16_t digitalTemp;
+
+  if(extended)	// 13 bit mode
+  {
+    digitalTemp = RegValue >> 3;
+	// Temperature data can be + or -, if it should be negative,
+	// convert 13 bit to 16 bit and use the 2s compliment.
+    if(digitalTemp > 0xFFF)
+    {
+      digitalTemp |= 0xE000;
+    }
+  }
+  else	// 12 bit mode
+  {
+    digitalTemp = RegValue >> 4;
+	// Temperature data can be + or -, if it should be negative,
+	// convert 12 bit to 16 bit and use the 2s compliment.
+    if(digitalTemp > 0x7FF)
+    {
+      digitalTemp |= 0xF000;
+    }
+  }
+  return (int16_t)digitalTemp;
+}
+
+/**
+  * @brief  Encode a temperature for the T_LOW or T_HIGH register.
+  * @param  counts: temperature in 1/16 degrees celcius.
+  * @param  extended: 1 to encode in 13 bit (extended mode) format.
+  * @retval register value.
+  */
+uint16_t TMP102_CountsToReg(int16_t counts, uint8_t extended)
+{
+  return extended ? (uint16_t)((uint16_t)counts << 3) : (uint16_t)((uint16_t)counts << 4);
+}
+
+/**
+  * @brief  Convert 1/16 degrees celcius to 0.1 degrees celcius.
+  * @param  counts: temperature in 1/16 degrees celcius, raw or calibrated.
+  * @retval temperature in 0.1 degrees celcius, rounded half away from zero.
+  */
+int16_t TMP102_CountsToTenths(int16_t counts)
+{
+  uint16_t magnitude = (counts < 0) ? (uint16_t)-counts : (uint16_t)counts;
+
+  // 1 count is 0.625 tenths: (magnitude*625 + 500)/1000 reduces to (magnitude*5 + 4)/8,
+  // which stays within 16 bits
+  magnitude = (magnitude*5 + 4) >> 3;
+  return (counts < 0) ? -(int16_t)magnitude : (int16_t)magnitude;
+}
+
+
+#ifndef TMP102_NO_FLOAT
+/**
+  * @brief  Convert 1/16 degrees celcius to degrees celcius.
+  * @param  counts: temperature in 1/16 degrees celcius.
+  * @retval temperature in degrees celcius, exact.
+  */
+float TMP102_CountsToC(int16_t counts)
+{
+  // Convert digital reading to analog temperature (1-bit is equal to 0.0625 C)
+  return counts*0.0625f;
+}
+
+/**
+  * @brief  Convert 1/16 degrees celcius to degrees fahrenheit.
+  * @param  counts: temperature in 1/16 degrees celcius.
+  * @retval temperature in degrees fahrenheit.
+  */
+float TMP102_CountsToF(int16_t counts)
+{
+  return TMP102_CountsToC(counts)*9.0/5.0 + 32.0;
+}
+#endif /* TMP102_NO_FLOAT */
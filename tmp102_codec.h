@@ -0,0 +1,36 @@
+/**
+  ******************************************************************************
+  * @file    tmp102_codec.h
+  * @author  Ngonidzashe Gwata
+  * @version V1.1.1
+  * @date    18-October-2026
+  * @brief   This file contains all the functions prototypes for the
+  *          TMP102 temperature conversions.
+  ******************************************************************************
+  *
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __TMP102_CODEC_H
+#define __TMP102_CODEC_H
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define TMP102_TEMP_INVALID	((int16_t)0x8000)	/*!< Returned by readTempC/readTempRaw/readLowTemp/readHighTemp when the sensor did not answer */
+
+/* Private macro -------------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+	int16_t TMP102_RegToCounts(uint16_t RegValue, uint8_t extended);	// Register value to 1/16 degrees C
+	uint16_t TMP102_CountsToReg(int16_t counts, uint8_t extended);	// 1/16 degrees C to register value
+	int16_t TMP102_CountsToTenths(int16_t counts);	// 1/16 degrees C to 0.1 degrees C, as readTempC
+#ifndef TMP102_NO_FLOAT
+	float TMP102_CountsToC(int16_t counts);	// 1/16 degrees C to degrees C
+	float TMP102_CountsToF(int16_t counts);	// 1/16 degrees C to degrees F
+#endif
+
+#endif /* __TMP102_CODEC_H */
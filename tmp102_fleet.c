@@ -0,0 +1,212 @@
+/**
+  ******************************************************************************
+  * @file    tmp102_fleet.c
+  * @author  Ngonidzashe Gwata
+  * @version V1.1.1
+  * @date    18-October-2026
+  * @brief   This file provides windowed min/max/mean and threshold exceedance
+  *          counts for large numbers of TMP102 sensors on a host.
+  *          Samples stay in the sensor's own 1/16 C counts and every field
+  *          is a separate array, so adding a sample touches a few adjacent
+  *          words and the per window passes are plain loops over contiguous
+  *          memory the compiler can vectorise. All storage is handed over
+  *          at Init, nothing is allocated per sample.
+  *          Windows older than the newest open one stay open to take late
+  *          samples until they are retired.
+  *          Device ranges never share an entry, so threads that each own a
+  *          range of devices can Add, Summarise and Clear concurrently;
+  *          Retire must run alone once every range has been cleared. The
+  *          Late counter is shared by every range, so it is a relaxed atomic;
+  *          late samples are rare and the on time path never touches it.
+  ******************************************************************************
+ */
+
+#include "tmp102_fleet.h"
+
+#define TMP102_FLEET_MIN_INIT	((int16_t)0x7FFF)
+#define TMP102_FLEET_MAX_INIT	((int16_t)-0x8000)
+
+/**
+  * @brief  Bytes of storage needed by TMP102_Fleet_Init.
+  */
+size_t TMP102_Fleet_StorageSize(uint32_t devices, uint32_t windows)
+{
+  size_t entries = (size_t)devices * windows;
+
+  return entries * (sizeof(int32_t) + 2 * sizeof(int16_t) + 3 * sizeof(uint16_t));
+}
+
+static void Fleet_ClearSlot(TMP102_Fleet *fleet, uint32_t slot, uint32_t first, uint32_t last)
+{
+  size_t base = (size_t)slot * fleet->Devices;
+  int32_t *sum = fleet->Sum + base;
+  int16_t *min = fleet->Min + base;
+  int16_t *max = fleet->Max + base;
+  uint16_t *count = fleet->Count + base;
+  uint16_t *over = fleet->OverHigh + base;
+  uint16_t *under = fleet->UnderLow + base;
+  uint32_t i;
+
+  for (i = first; i < last; i++)
+  {
+    sum[i] = 0;
+    min[i] = TMP102_FLEET_MIN_INIT;
+    max[i] = TMP102_FLEET_MAX_INIT;
+    count[i] = 0;
+    over[i] = 0;
+    under[i] = 0;
+  }
+}
+
+/**
+  * @brief  Initialise the aggregator.
+  * @param  storage: TMP102_Fleet_StorageSize(devices, windows) bytes, 4 byte aligned.
+  * @param  windows: number of windows kept open, 2 or more to accept late samples.
+  * @param  windowMs: window length, 60000 for per minute statistics.
+  * @param  start: time (ms) inside the first window.
+  * @param  lowLimit, highLimit: exceedance thresholds in 1/16 C.
+  * @retval None
+  */
+void TMP102_Fleet_Init(TMP102_Fleet *fleet, void *storage, uint32_t devices,
+                       uint32_t windows, uint32_t windowMs, uint64_t start,
+                       int16_t lowLimit, int16_t highLimit)
+{
+  size_t entries = (size_t)devices * windows;
+  uint32_t w;
+
+  // Widest arrays first so every array stays naturally aligned
+  fleet->Sum = (int32_t *)storage;
+  fleet->Min = (int16_t *)(fleet->Sum + entries);
+  fleet->Max = fleet->Min + entries;
+  fleet->Count = (uint16_t *)(fleet->Max + entries);
+  fleet->OverHigh = fleet->Count + entries;
+  fleet->UnderLow = fleet->OverHigh + entries;
+
+  fleet->Devices = devices;
+  fleet->Windows = windows;
+  fleet->WindowMs = windowMs;
+  fleet->Oldest = start / windowMs;
+  fleet->OldestSlot = (uint32_t)(fleet->Oldest % windows);
+  fleet->LowLimit = lowLimit;
+  fleet->HighLimit = highLimit;
+  atomic_init(&fleet->Late, 0);
+
+  for (w = 0; w < windows; w++)
+  {
+    Fleet_ClearSlot(fleet, w, 0, devices);
+  }
+}
+
+/**
+  * @brief  Add one sample to the window its timestamp falls in.
+  * @param  device: device index (0 - Devices-1).
+  * @param  time: time the sample was taken, ms.
+  * @param  raw: temperature in 1/16 C as returned by readTempRaw.
+  *         TMP102_TEMP_INVALID is rejected as TMP102_FLEET_INVALID.
+  * @retval TMP102_FLEET_OK if the sample was counted.
+  */
+TMP102_FleetStatus TMP102_Fleet_Add(TMP102_Fleet *fleet, uint32_t device,
+                                    uint64_t time, int16_t raw)
+{
+  uint64_t window = time / fleet->WindowMs;
+  uint32_t slot;
+  size_t i;
+
+  if (device >= fleet->Devices)
+  {
+    return TMP102_FLEET_BAD_DEVICE;
+  }
+  if (raw == TMP102_TEMP_INVALID)
+  {
+    return TMP102_FLEET_INVALID;
+  }
+  if (window < fleet->Oldest)
+  {
+    atomic_fetch_add_explicit(&fleet->Late, 1, memory_order_relaxed);
+    return TMP102_FLEET_LATE;
+  }
+  if (window - fleet->Oldest >= fleet->Windows)
+  {
+    return TMP102_FLEET_AHEAD;
+  }
+
+  // Slots follow windows round robin from the oldest one
+  slot = fleet->OldestSlot + (uint32_t)(window - fleet->Oldest);
+  slot -= (slot >= fleet->Windows) ? fleet->Windows : 0;
+  i = (size_t)slot * fleet->Devices + device;
+  fleet->Sum[i] += raw;
+  fleet->Min[i] = (raw < fleet->Min[i]) ? raw : fleet->Min[i];
+  fleet->Max[i] = (raw > fleet->Max[i]) ? raw : fleet->Max[i];
+  fleet->Count[i]++;
+  fleet->OverHigh[i] += (raw > fleet->HighLimit);
+  fleet->UnderLow[i] += (raw < fleet->LowLimit);
+  return TMP102_FLEET_OK;
+}
+
+/**
+  * @brief  Add a batch of samples held as parallel arrays.
+  * @retval number of samples counted, the rest were late, ahead or invalid.
+  */
+uint32_t TMP102_Fleet_AddBatch(TMP102_Fleet *fleet, const uint32_t *device,
+                               const uint64_t *time, const int16_t *raw, uint32_t n)
+{
+  uint32_t i, accepted = 0;
+
+  for (i = 0; i < n; i++)
+  {
+    accepted += (TMP102_Fleet_Add(fleet, device[i], time[i], raw[i]) == TMP102_FLEET_OK);
+  }
+  return accepted;
+}
+
+/**
+  * @brief  Summarise devices [first, last) of the oldest open window.
+  * @param  view: filled with the window index and arrays starting at device first.
+  * @param  mean: last - first entries, rounded mean in 1/16 C (0 where Count is 0).
+  * @retval None
+  */
+void TMP102_Fleet_Summarise(const TMP102_Fleet *fleet, uint32_t first, uint32_t last,
+                            TMP102_FleetWindow *view, int16_t *mean)
+{
+  size_t base = (size_t)fleet->OldestSlot * fleet->Devices + first;
+  const int32_t *sum = fleet->Sum + base;
+  const uint16_t *count = fleet->Count + base;
+  uint32_t i, n = last - first;
+  int32_t s, c;
+
+  view->Window = fleet->Oldest;
+  view->Min = fleet->Min + base;
+  view->Max = fleet->Max + base;
+  view->Count = count;
+  view->OverHigh = fleet->OverHigh + base;
+  view->UnderLow = fleet->UnderLow + base;
+
+  for (i = 0; i < n; i++)
+  {
+    s = sum[i];
+    c = count[i] ? count[i] : 1;
+    // Round half away from zero, as readTempC does
+    mean[i] = (int16_t)((s + ((s < 0) ? -(c / 2) : (c / 2))) / c);
+  }
+}
+
+/**
+  * @brief  Reset devices [first, last) of the oldest window for reuse.
+  */
+void TMP102_Fleet_Clear(TMP102_Fleet *fleet, uint32_t first, uint32_t last)
+{
+  Fleet_ClearSlot(fleet, fleet->OldestSlot, first, last);
+}
+
+/**
+  * @brief  Retire the oldest window, its slot becomes the newest open window.
+  * @Note 	Every device of the oldest window must have been cleared first.
+  */
+void TMP102_Fleet_Retire(TMP102_Fleet *fleet)
+{
+  fleet->Oldest++;
+  if (++fleet->OldestSlot == fleet->Windows)
+  {
+    fleet->OldestSlot = 0;
+  }
+}
@@ -0,0 +1,103 @@
+/**
+  ******************************************************************************
+  * @file    tmp102_fleet.h
+  * @author  Ngonidzashe Gwata
+  * @version V1.1.1
+  * @date    18-October-2026
+  * @brief   This file contains all the functions prototypes for the
+  *          host side fleet aggregation of TMP102 readings.
+  ******************************************************************************
+  *
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __TMP102_FLEET_H
+#define __TMP102_FLEET_H
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "tmp102_codec.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/**
+  * @brief  Result of adding a sample
+  */
+typedef enum
+{
+  TMP102_FLEET_OK = 0,
+  TMP102_FLEET_LATE,		/*!< Window already retired, sample dropped */
+  TMP102_FLEET_AHEAD,		/*!< Window not open yet, retire the oldest first */
+  TMP102_FLEET_BAD_DEVICE,	/*!< Device index out of range */
+  TMP102_FLEET_INVALID		/*!< TMP102_TEMP_INVALID, the read failed */
+} TMP102_FleetStatus;
+
+/**
+  * @brief  Aggregator state. Statistics are held as one array per field,
+  *         Windows slots of Devices entries each, all in 1/16 C counts.
+  *         Times are 64-bit ms, so epoch or uptime clocks never wrap.
+  */
+typedef struct
+{
+  uint32_t Devices;
+  uint32_t Windows;			/*!< Open windows, older ones take late samples */
+  uint32_t WindowMs;		/*!< Window length */
+  uint32_t OldestSlot;		/*!< Slot holding the oldest open window */
+  uint64_t Oldest;			/*!< Index (time / WindowMs) of the oldest open window */
+  int16_t HighLimit;		/*!< Samples above this count in OverHigh */
+  int16_t LowLimit;			/*!< Samples below this count in UnderLow */
+  int32_t *Sum;
+  int16_t *Min;
+  int16_t *Max;
+  uint16_t *Count;
+  uint16_t *OverHigh;
+  uint16_t *UnderLow;
+  atomic_uint_least64_t Late;	/*!< Samples dropped as TMP102_FLEET_LATE, read with atomic_load */
+} TMP102_Fleet;
+
+/**
+  * @brief  Read only view of one window for devices [First, Last).
+  *         Entries with Count 0 received no sample.
+  */
+typedef struct
+{
+  uint64_t Window;			/*!< Window index, start time is Window * WindowMs */
+  const int16_t *Min;
+  const int16_t *Max;
+  const uint16_t *Count;
+  const uint16_t *OverHigh;
+  const uint16_t *UnderLow;
+} TMP102_FleetWindow;
+
+/* Private define ------------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+	size_t TMP102_Fleet_StorageSize(uint32_t devices, uint32_t windows);	// Bytes Init needs
+
+	// Carve the statistics arrays out of storage, first window opens at start (ms)
+	void TMP102_Fleet_Init(TMP102_Fleet *fleet, void *storage, uint32_t devices,
+	                       uint32_t windows, uint32_t windowMs, uint64_t start,
+	                       int16_t lowLimit, int16_t highLimit);
+
+	// Add one sample (readTempRaw counts) taken at time (ms)
+	TMP102_FleetStatus TMP102_Fleet_Add(TMP102_Fleet *fleet, uint32_t device,
+	                                    uint64_t time, int16_t raw);
+
+	// Add n samples, returns how many were accepted
+	uint32_t TMP102_Fleet_AddBatch(TMP102_Fleet *fleet, const uint32_t *device,
+	                               const uint64_t *time, const int16_t *raw, uint32_t n);
+
+	// View the oldest window and write the rounded mean of devices [first, last)
+	void TMP102_Fleet_Summarise(const TMP102_Fleet *fleet, uint32_t first, uint32_t last,
+	                            TMP102_FleetWindow *view, int16_t *mean);
+
+	// Clear devices [first, last) of the oldest window
+	void TMP102_Fleet_Clear(TMP102_Fleet *fleet, uint32_t first, uint32_t last);
+
+	// Close the oldest window once every range has been cleared, opening a new one
+	void TMP102_Fleet_Retire(TMP102_Fleet *fleet);
+
+#endif /* __TMP102_FLEET_H */
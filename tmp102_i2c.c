@@ -27,56 +27,81 @@
   */
 	
 #include "tmp102_i2c.h"
+#ifdef TMP102_USE_ARBITER
+#include "tmp102_arbiter.h"
+#endif
+
+static uint8_t DeviceAddress = TMP102_ADDR;	// Sensor the driver functions talk to
 
 /**
-  * @brief  Checks the TMP102 status.
-  * @param  None
-  * @retval ErrorStatus: TMP102 Status (ERROR or SUCCESS).
+  * @brief  Select the sensor every following driver call addresses.
+  * @param  Address: TMP102_ADDR or one of TMP102_ADDR_GND/VCC/SDA/SCL.
+  * @retval None
   */
-ErrorStatus TMP102_GetStatus(void)
+void TMP102_SelectDevice(uint8_t Address)
 {
-  uint32_t I2C_TimeOut = I2C_TIMEOUT;
-
-  /* Clear the TMP102_I2C AF flag */
-  I2C_ClearFlag(TMP102_I2C, I2C_FLAG_AF);
+  DeviceAddress = Address;
+}
 
-  /* Enable TMP102_I2C acknowledgement if it is already disabled by other function */
-  I2C_AcknowledgeConfig(TMP102_I2C, ENABLE);
+/**
+  * @brief  Fill in one step of a bus sequence.
+  */
+void TMP102_SetStep(TMP102_BusStep *Step, uint8_t Address, uint8_t *pBuffer, uint8_t NumByte)
+{
+  Step->Address = Address;
+  Step->pBuffer = pBuffer;
+  Step->NumByte = NumByte;
+}
 
-  /*---------------------------- Transmission Phase ---------------------------*/
+/**
+  * @brief  Run a bus sequence as one unit.
+  * @param  Steps: transfers to run in order, stops at the first failure.
+  * @param  NumStep: number of transfers.
+  * @retval SUCCESS if every transfer completed.
+  * @Note 	With TMP102_USE_ARBITER defined the sequence is queued on the bus
+  *         arbiter at TMP102_ARB_PRIORITY, so no other driver's traffic can
+  *         land between its steps.
+  */
+ErrorStatus TMP102_Transfer(TMP102_BusStep *Steps, uint8_t NumStep)
+{
+#ifdef TMP102_USE_ARBITER
+  TMP102_Transaction txn;
 
-  /* Send TMP102_I2C START condition */
-  I2C_GenerateSTART(TMP102_I2C, ENABLE);
+  txn.Steps = Steps;
+  txn.NumStep = NumStep;
+  txn.Priority = TMP102_ARB_PRIORITY;
+  return TMP102_Arbiter_Execute(&txn);
+#else
+  ErrorStatus status = SUCCESS;
 
-  /* Test on TMP102_I2C EV5 and clear it */
-  while ((!I2C_CheckEvent(TMP102_I2C, I2C_EVENT_MASTER_MODE_SELECT)) && I2C_TimeOut)  /* EV5 */
-  {
-    I2C_TimeOut--;
-  }
-  if (I2C_TimeOut == 0)
+  while (status == SUCCESS && NumStep--)
   {
-    return ERROR;
+    if (Steps->Address & TMP102_BUS_READ)
+    {
+      status = TMP102_Bus_Read(Steps->Address, Steps->pBuffer, Steps->NumByte);
+    }
+    else
+    {
+      status = TMP102_Bus_Write(Steps->Address, Steps->pBuffer, Steps->NumByte);
+    }
+    Steps++;
   }
-  I2C_TimeOut = I2C_TIMEOUT;
-
-  /*!< Send STTMP102 slave address for write */
-  I2C_Send7bitAddress(TMP102_I2C, TMP102_ADDR, I2C_Direction_Transmitter);
+  return status;
+#endif
+}
 
-  while ((!I2C_CheckEvent(TMP102_I2C, I2C_EVENT_MASTER_TRANSMITTER_MODE_SELECTED)) && I2C_TimeOut)/* EV6 */
-  {
-    I2C_TimeOut--;
-  }
+/**
+  * @brief  Checks the TMP102 status.
+  * @param  None
+  * @retval ErrorStatus: TMP102 Status (ERROR or SUCCESS).
+  */
+ErrorStatus TMP102_GetStatus(void)
+{
+  TMP102_BusStep step;
 
-  if ((I2C_GetFlagStatus(TMP102_I2C, I2C_FLAG_AF) != 0x00) || (I2C_TimeOut == 0))
-  {
-    return ERROR;
-  }
-  else
-  {
-		/* Send TMP102_I2C STOP Condition */
-		I2C_GenerateSTOP(TMP102_I2C, ENABLE); // Close communication with TMP102
-    return SUCCESS;
-  }
+  // Address only write, SUCCESS if the sensor acknowledges
+  TMP102_SetStep(&step, DeviceAddress, 0, 0);
+  return TMP102_Transfer(&step, 1);
 }
 
 /**
@@ -86,71 +111,20 @@ ErrorStatus TMP102_GetStatus(void)
   */
 void TMP102_reset(void)
 {
+  TMP102_BusStep step;
+  uint8_t cmd = 0x06;	// reset cmd
 
-  /* Clear the TMP102_I2C AF flag */
-  I2C_ClearFlag(TMP102_I2C, I2C_FLAG_AF);
-
-  /* Enable TMP102_I2C acknowledgement if it is already disabled by other function */
-  I2C_AcknowledgeConfig(TMP102_I2C, ENABLE);
-
-  /*---------------------------- Transmission Phase ---------------------------*/
-
-  /* Send TMP102_I2C START condition */
-  I2C_GenerateSTART(TMP102_I2C, ENABLE);
-
-  /* Test on TMP102_I2C EV5 and clear it */
-  while ((!I2C_CheckEvent(TMP102_I2C, I2C_EVENT_MASTER_MODE_SELECT)) )  /* EV5 */
-  {
-  }
-
-  /*!< Send STTMP102 slave address for write */
-  I2C_Send7bitAddress(TMP102_I2C, 0x00, I2C_Direction_Transmitter);
-
-  while ((!I2C_CheckEvent(TMP102_I2C, I2C_EVENT_MASTER_TRANSMITTER_MODE_SELECTED)))/* EV6 */
-  {
-  }
-	 /* Send the reset cmd */
-  I2C_SendData(TMP102_I2C, 6);
-	/* Test on TMP102_I2C EV8 and clear it */
-  while (!I2C_CheckEvent(TMP102_I2C, I2C_EVENT_MASTER_BYTE_TRANSMITTED)) /* EV8 */
-  {
-  }
-  /* Send TMP102_I2C STOP Condition */
-  I2C_GenerateSTOP(TMP102_I2C, ENABLE); // Close communication with TMP102
+  TMP102_SetStep(&step, 0x00, &cmd, 1);
+  TMP102_Transfer(&step, 1);
 }
 
 
 void openPointerRegister(uint8_t RegName)
-{ 
-	/* Enable TMP102_I2C acknowledgement if it is already disabled by other function */
-  I2C_AcknowledgeConfig(TMP102_I2C, ENABLE);
-
-  /*--------------------------- Transmission Phase ----------------------------*/
-  /* Send TMP102_I2C START condition */
-  I2C_GenerateSTART(TMP102_I2C, ENABLE);
-
-  /* Test on TMP102_I2C EV5 and clear it */
-  while (!I2C_CheckEvent(TMP102_I2C, I2C_EVENT_MASTER_MODE_SELECT))  /* EV5 */
-  {
-  }
-
-  /* Send STTMP102 slave address for write */
-  I2C_Send7bitAddress(TMP102_I2C, TMP102_ADDR, I2C_Direction_Transmitter);
-
-  /* Test on TMP102_I2C EV6 and clear it */
-  while (!I2C_CheckEvent(TMP102_I2C, I2C_EVENT_MASTER_TRANSMITTER_MODE_SELECTED)) /* EV6 */
-  {
-  }
-
-  /* Send the specified register data pointer */
-  I2C_SendData(TMP102_I2C, RegName);
+{
+  TMP102_BusStep step;
 
-  /* Test on TMP102_I2C EV8 and clear it */
-  while (!I2C_CheckEvent(TMP102_I2C, I2C_EVENT_MASTER_BYTE_TRANSMITTED)) /* EV8 */
-  {
-  }
-  /* Send TMP102_I2C STOP Condition */
-  I2C_GenerateSTOP(TMP102_I2C, ENABLE); // Close communication with TMP102
+  TMP102_SetStep(&step, DeviceAddress, &RegName, 1);
+  TMP102_Transfer(&step, 1);
 }
 
 /**
@@ -161,449 +135,416 @@ void openPointerRegister(uint8_t RegName)
   *                  - T_LOW_REGISTER: Over-limit temperature register
   *                  - T_HIGH_REGISTER: Hysteresis temperature register
   * @param  RegValue: value to be written to TMP102 register.
-  * @retval None
+  * @retval SUCCESS if the sensor acknowledged the write.
   * @Note 	after the write operation, the pointer register is set to temperature register
   */
-void TMP102_WriteReg(uint8_t RegName, uint16_t RegValue)
+ErrorStatus TMP102_WriteReg(uint8_t RegName, uint16_t RegValue)
 {
-	/* Enable TMP102_I2C acknowledgement if it is already disabled by other function */
-  I2C_AcknowledgeConfig(TMP102_I2C, ENABLE);
-
-  /*-------------------------------- Transmission Phase -----------------------*/
-  //#if 0
-  /* Send TMP102_I2C START condition */
-  I2C_GenerateSTART(TMP102_I2C, ENABLE);
-
-  /* Test on TMP102_I2C EV5 and clear it */
-  while (!I2C_CheckEvent(TMP102_I2C, I2C_EVENT_MASTER_MODE_SELECT))  /* EV5 */
-  {
-  }
+  TMP102_BusStep steps[2];
+  uint8_t registerByte[4];
 
-  /* Send STTMP102 slave address for write */
-  I2C_Send7bitAddress(TMP102_I2C, TMP102_ADDR, I2C_Direction_Transmitter);
+  registerByte[0] = RegName;	// pointer register
+  registerByte[1] = (uint8_t)(RegValue >> 8);
+  registerByte[2] = (uint8_t)RegValue;
+  registerByte[3] = TEMPERATURE_REGISTER;
 
-  /* Test on TMP102_I2C EV6 and clear it */
-  while (!I2C_CheckEvent(TMP102_I2C, I2C_EVENT_MASTER_TRANSMITTER_MODE_SELECTED)) /* EV6 */
-  {
-  }
-
-  /* Send the specified register data pointer */
-  I2C_SendData(TMP102_I2C, RegName);
-
-  /* Test on TMP102_I2C EV8 and clear it */
-  while (!I2C_CheckEvent(TMP102_I2C, I2C_EVENT_MASTER_BYTE_TRANSMITTED)) /* EV8 */
-  {
-  }
-
-  /* Send TMP102_I2C data */
-  I2C_SendData(TMP102_I2C, (uint8_t)(RegValue >> 8));
-
-  /* Test on TMP102_I2C EV8 and clear it */
-  while (!I2C_CheckEvent(TMP102_I2C, I2C_EVENT_MASTER_BYTE_TRANSMITTED)) /* EV8 */
-  {
-  }
-
-  /* Send TMP102_I2C data */
-  I2C_SendData(TMP102_I2C, (uint8_t)RegValue);
-
-  /* Test on TMP102_I2C EV8 and clear it */
-  while (!I2C_CheckEvent(TMP102_I2C, I2C_EVENT_MASTER_BYTE_TRANSMITTED)) /* EV8 */
-  {
-  }
-
-  /* Send TMP102_I2C STOP Condition */
-  I2C_GenerateSTOP(TMP102_I2C, ENABLE);
-  
+  TMP102_SetStep(&steps[0], DeviceAddress, registerByte, 3);
   //point to temperature register
-  openPointerRegister(TEMPERATURE_REGISTER);
-} 
+  TMP102_SetStep(&steps[1], DeviceAddress, &registerByte[3], 1);
+  return TMP102_Transfer(steps, 2);
+}
 
 
   /**
   * @brief  Read the register from the TMP102, specified in point register .
-  * @param  None
-  * @retval TMP102 register value.
+  * @param  Value: receives the register value, left untouched on error.
+  * @retval ERROR if the sensor did not respond.
   */
 
-uint16_t TMP102_ReadReg(void)
+ErrorStatus TMP102_ReadReg(uint16_t *Value)
 {
-  
-  __IO uint16_t RegValue = 0;
-  
-#if 0
-  /* Enable TMP102_I2C acknowledgement if it is already disabled by other function */
-  I2C_AcknowledgeConfig(TMP102_I2C, ENABLE);
+  TMP102_BusStep step;
+  uint8_t registerByte[2];
 
-  /*--------------------------- Transmission Phase ----------------------------*/
-  /* Send TMP102_I2C START condition */
-  I2C_GenerateSTART(TMP102_I2C, ENABLE);
-
-  /* Test on TMP102_I2C EV5 and clear it */
-  while (!I2C_CheckEvent(TMP102_I2C, I2C_EVENT_MASTER_MODE_SELECT))  /* EV5 */
+  TMP102_SetStep(&step, DeviceAddress | TMP102_BUS_READ, registerByte, 2);
+  if (TMP102_Transfer(&step, 1) != SUCCESS)
   {
+    return ERROR;
   }
+  *Value = (uint16_t)((registerByte[0] << 8) | registerByte[1]);
+  return SUCCESS;
+}
 
-  /* Send STTMP102 slave address for write */
-  I2C_Send7bitAddress(TMP102_I2C, TMP102_ADDR, I2C_Direction_Transmitter);
+/**
+  * @brief  Read any register and point back to the temperature register, as one unit.
+  * @param  RegName: register to read.
+  * @param  Value: receives the register value, left untouched on error.
+  * @retval ERROR if the sensor did not respond.
+  */
+ErrorStatus TMP102_ReadRegAt(uint8_t RegName, uint16_t *Value)
+{
+  TMP102_BusStep steps[3];
+  uint8_t pointer[2];
+  uint8_t registerByte[2];
 
-  /* Test on TMP102_I2C EV6 and clear it */
-  while (!I2C_CheckEvent(TMP102_I2C, I2C_EVENT_MASTER_TRANSMITTER_MODE_SELECTED)) /* EV6 */
+  pointer[0] = RegName;
+  pointer[1] = TEMPERATURE_REGISTER;
+  TMP102_SetStep(&steps[0], DeviceAddress, &pointer[0], 1);
+  TMP102_SetStep(&steps[1], DeviceAddress | TMP102_BUS_READ, registerByte, 2);
+  TMP102_SetStep(&steps[2], DeviceAddress, &pointer[1], 1);
+  if (TMP102_Transfer(steps, 3) != SUCCESS)
   {
+    return ERROR;
   }
+  *Value = (uint16_t)((registerByte[0] << 8) | registerByte[1]);
+  return SUCCESS;
+}
 
-  /* Send the specified register data pointer */
-  I2C_SendData(TMP102_I2C, RegName);
+/**
+  * @brief  Configuration register fields, indexed by TMP102_FIELD_xx.
+  */
+static const struct
+{
+  uint16_t Mask;
+  uint8_t Shift;
+} ConfigField[] =
+{
+  {0x0010, 4},	// EM
+  {0x0020, 5},	// AL
+  {0x00C0, 6},	// CR0/1
+  {0x0100, 8},	// SD
+  {0x0200, 9},	// TM
+  {0x0400, 10},	// POL
+  {0x1800, 11},	// F0/1
+  {0x8000, 15}	// OS
+};
 
-  /* Test on TMP102_I2C EV8 and clear it */
-  while (!I2C_CheckEvent(TMP102_I2C, I2C_EVENT_MASTER_BYTE_TRANSMITTED)) /* EV8 */
-  {
-  }
-#endif
-  /*------------------------------ Reception Phase ----------------------------*/
-  /* Send Re-STRAT condition */
-  I2C_GenerateSTART(TMP102_I2C, ENABLE);
+/**
+  * @brief  Replace one field of a configuration register value.
+  * @param  RegValue: configuration register value.
+  * @param  Field: one of TMP102_FIELD_xx.
+  * @param  Value: new field value, extra high bits are dropped.
+  * @retval the updated register value.
+  */
+uint16_t TMP102_FieldInsert(uint16_t RegValue, uint8_t Field, uint8_t Value)
+{
+  RegValue &= (uint16_t)~ConfigField[Field].Mask;
+  return RegValue | (((uint16_t)Value << ConfigField[Field].Shift) & ConfigField[Field].Mask);
+}
 
-  /* Test on EV5 and clear it */
-  while (!I2C_CheckEvent(TMP102_I2C, I2C_EVENT_MASTER_MODE_SELECT))  /* EV5 */
-  {
-  }
+/**
+  * @brief  Extract one field of a configuration register value.
+  * @param  RegValue: configuration register value.
+  * @param  Field: one of TMP102_FIELD_xx.
+  * @retval the field value.
+  */
+uint8_t TMP102_FieldExtract(uint16_t RegValue, uint8_t Field)
+{
+  return (uint8_t)((RegValue & ConfigField[Field].Mask) >> ConfigField[Field].Shift);
+}
 
-  /* Send STTMP102 slave address for read */
-  I2C_Send7bitAddress(TMP102_I2C, TMP102_ADDR, I2C_Direction_Receiver);
+/**
+  * @brief  Read one field of the configuration register.
+  * @param  Field: one of TMP102_FIELD_xx.
+  * @param  Value: receives the field value, left untouched on error.
+  * @retval ERROR if the sensor did not respond.
+  * @Note 	The pointer register is set back to the temperature register.
+  */
+ErrorStatus TMP102_ReadField(uint8_t Field, uint8_t *Value)
+{
+  uint16_t registerByte_16;
 
-  /* Test on EV6 and clear it */
-  while (!I2C_CheckEvent(TMP102_I2C, I2C_EVENT_MASTER_RECEIVER_MODE_SELECTED))  /* EV6 */
+  if (TMP102_ReadRegAt(CONFIG_REGISTER, &registerByte_16) != SUCCESS)
   {
+    return ERROR;
   }
+  *Value = TMP102_FieldExtract(registerByte_16, Field);
+  return SUCCESS;
+}
+
+/**
+  * @brief  Read-modify-write one field of the configuration register.
+  * @param  Field: one of TMP102_FIELD_xx.
+  * @param  Value: new field value.
+  * @retval ERROR if the read or the write failed.
+  * @Note 	OS is cleared in the value written back unless it is the field being
+  *         set, so changing another field never starts a one-shot conversion.
+  *         Nothing is written if the read fails, so a bus error can never
+  *         turn into a corrupt configuration.
+  */
+ErrorStatus TMP102_WriteField(uint8_t Field, uint8_t Value)
+{
+  uint16_t registerByte_16; // Store the data from the register here
 
-  /* Test on EV7 and clear it */
-  while (!I2C_CheckEvent(TMP102_I2C, I2C_EVENT_MASTER_BYTE_RECEIVED))  /* EV7 */
+  // Read current configuration register value
+  if (TMP102_ReadRegAt(CONFIG_REGISTER, &registerByte_16) != SUCCESS)
   {
+    return ERROR;
   }
+  registerByte_16 &= 0x7FFF;
 
-  /* Store TMP102_I2C received data */
-  RegValue = (uint16_t)(I2C_ReceiveData(TMP102_I2C) << 8);
-
-  /* Disable TMP102_I2C acknowledgement */
-  I2C_AcknowledgeConfig(TMP102_I2C, DISABLE);
-
-  /* Send TMP102_I2C STOP Condition */
-  I2C_GenerateSTOP(TMP102_I2C, ENABLE);
-
-  /* Test on RXNE flag */
-  while (I2C_GetFlagStatus(TMP102_I2C, I2C_FLAG_RXNE) == RESET)
-  {}
+  // Set configuration registers, pointer goes back to temperature register
+  return TMP102_WriteReg(CONFIG_REGISTER, TMP102_FieldInsert(registerByte_16, Field, Value));
+}
 
-  /* Store TMP102_I2C received data */
-  RegValue |= I2C_ReceiveData(TMP102_I2C);
+/**
+  * @brief  Read the EM bit of the configuration register.
+  * @param  extended: receives the EM bit, left untouched on error.
+  * @retval ERROR if the sensor did not respond.
+  */
+static ErrorStatus extendedMode(bool *extended)
+{
+  uint8_t em;
 
-  /* Return register value */
-  return (RegValue);
+  if (TMP102_ReadField(TMP102_FIELD_EM, &em) != SUCCESS)
+  {
+    return ERROR;
+  }
+  *extended = (bool)em;
+  return SUCCESS;
 }
 
  /**
-  * @brief  Read temperature in degrees celcius from the TMP102.
+  * @brief  Read temperature from the TMP102, rounded to 0.1 degrees celcius.
   * @param  None
-  * @retval temperatue float value.
-  * @Note 	When reading temperature register, there is no need to call openPointerRegister(TEMPERATURE_REGISTER). 
-  * 		The power-up reset value of pointer register points to the temperature register. After reading/writing to any 
-  * 		other register, control register must be pointed back to temperature register. This speeds up the temp read and overal 
+  * @retval temperature in 0.1 degrees celcius, TMP102_TEMP_INVALID if the sensor did not answer.
+  * @Note 	When reading temperature register, there is no need to call openPointerRegister(TEMPERATURE_REGISTER).
+  * 		The power-up reset value of pointer register points to the temperature register. After reading/writing to any
+  * 		other register, control register must be pointed back to temperature register. This speeds up the temp read and overal
   * 		performance(since there are more reading to the temp register than there are to any other registers)
   */
 int16_t readTempC(void)
 {
-  uint8_t registerByte[2];	// Store the data from the register here
-  uint16_t digitalTempRaw, digitalTemp;  // Temperature stored in TMP102 register
-  int32_t temperature;  // Temperature stored in TMP102 register
-  
-  // Read Temperature
-  // ASSUMPTION here is that the pointer address is already set to temperature register (0)
-  //openPointerRegister(TEMPERATURE_REGISTER) is not called;
-  // Read from temperature register
-  digitalTempRaw = TMP102_ReadReg();
-  //registerByte[0] = readRegister(0);
-  //registerByte[1] = readRegister(1);
-  //if(digitalTempRaw == 0xFFFF)
-  //{	//there is some form of error, the return value should not be this value
-	//return NAN;
-  //}
-  // Bit 0  will always be 0 in 12-bit readings and 1 in 13-bit
-  if(digitalTempRaw&0x01)	// 13 bit mode
+  int16_t counts;
+
+  if (readTempRawEx(&counts) != SUCCESS)
   {
-	// Combine bytes to create a signed int
-    digitalTemp = digitalTempRaw >> 3;
-	// Temperature data can be + or -, if it should be negative,
-	// convert 13 bit to 16 bit and use the 2s compliment.
-    if(digitalTemp > 0xFFF)
-	{
-      digitalTemp |= 0xE000;
-      digitalTemp *= -1;//get the absolute value
-			temperature = (((uint32_t)digitalTemp*625)+ 500)/1000;
-			temperature *= (-1);//convert it back to a nagative
-    }	
-		else
-		{//positive temp
-			temperature = (((uint32_t)digitalTemp*625)+ 500)/1000; //
-		}
+    return TMP102_TEMP_INVALID;
   }
-  else	// 12 bit mode
+  return TMP102_CountsToTenths(counts);
+}
+
+ /**
+  * @brief  Read the temperature register as a signed count of 0.0625 C steps.
+  * @param  None
+  * @retval temperature in 1/16 degrees celcius, no rounding applied,
+  *         TMP102_TEMP_INVALID if the sensor did not answer.
+  * @Note 	Same pointer register assumption as readTempC.
+  */
+int16_t readTempRaw(void)
+{
+  int16_t counts;
+
+  if (readTempRawEx(&counts) != SUCCESS)
   {
-	// Combine bytes to create a signed int 
-    digitalTemp = digitalTempRaw >> 4;
-    //digitalTemp = 0xe70;
-	// Temperature data can be + or -, if it should be negative,
-	// convert 12 bit to 16 bit and use the 2s compliment.
-    if(digitalTemp > 0x7FF)
-		{
-      digitalTemp |= 0xF000;
-      digitalTemp *= -1;//get the absolute value
-			temperature = (((uint32_t)digitalTemp*625)+ 500)/1000;
-			temperature *= (-1);//convert it back to a nagative
-    }	
-		else
-		{//positive temp
-			temperature = (((uint32_t)digitalTemp*625)+ 500)/1000; //
-		}
+    return TMP102_TEMP_INVALID;
   }
-	return temperature;
-	//return 0xffbc;
-  //Convert digital reading to analog temperature (1-bit is equal to 0.0625 C)
-  //return digitalTemp*0.0625; //float value
+  return counts;
 }
 
-
-float readTempF(void)
+ /**
+  * @brief  Read the temperature register, reporting a sensor that does not answer.
+  * @param  counts: receives the temperature in 1/16 degrees celcius, left untouched on error.
+  * @retval ERROR if the sensor did not answer.
+  * @Note 	Same pointer register assumption as readTempC.
+  */
+ErrorStatus readTempRawEx(int16_t *counts)
 {
-	return readTempC()*9.0/5.0 + 32.0;
+  uint16_t digitalTempRaw;
+
+  if (TMP102_ReadReg(&digitalTempRaw) != SUCCESS)
+  {
+    return ERROR;
+  }
+  // Bit 0  will always be 0 in 12-bit readings and 1 in 13-bit
+  *counts = TMP102_RegToCounts(digitalTempRaw, (bool)(digitalTempRaw & 0x01));
+  return SUCCESS;
 }
 
-uint8_t readRegister(bool registerNumber){  
+uint8_t readRegister(bool registerNumber){
   uint8_t registerByte[2];	// We'll store the data from the registers here
-  uint16_t registerByte_16; // Store the data from the register here
-  
+  uint16_t registerByte_16 = NAN; // Store the data from the register here
+
   // Read current configuration register value
- registerByte_16 = TMP102_ReadReg(); 	// Read two bytes from TMP102
+ TMP102_ReadReg(&registerByte_16); 	// Read two bytes from TMP102
   registerByte[0] = (uint8_t)registerByte_16;	// Read first byte
   registerByte_16 = registerByte_16 >> 8;
   registerByte[1] = (uint8_t)registerByte_16;	// Read second byte
-  
+
   return registerByte[registerNumber];
 }
- 
+
 void setConversionRate(uint8_t rate)
 {
-  uint8_t registerByte[2]; 
-  uint16_t registerByte_16; // Store the data from the register here
-  
-  rate = rate&0x03; // Make sure rate is not set higher than 3.
-  
-  // Change pointer address to configuration register (0x01)
-  openPointerRegister(CONFIG_REGISTER);
-  
-  // Read current configuration register value
-  registerByte_16 = TMP102_ReadReg();
+  TMP102_WriteField(TMP102_FIELD_CR, rate);
+}
 
-  // Load new conversion rate
-  //registerByte[1] &= 0x3F;  // Clear CR0/1 (bit 6 and 7 of second byte)
-  //registerByte[1] |= rate<<6;	// Shift in new conversion rate
-  registerByte_16 &= 0xFF3F;  // Clear CR0/1 (bit 6 and 7 of second byte)
-  registerByte_16 |= rate<<6;	// Shift in new conversion rate
 
-  // Set configuration registers
-  TMP102_WriteReg(CONFIG_REGISTER, registerByte_16);
+void setExtendedMode(bool mode)
+{
+  TMP102_WriteField(TMP102_FIELD_EM, mode);
 }
 
 
-void setExtendedMode(bool mode) 
+void tmp102_sleep(void)
 {
-  uint8_t registerByte[2]; // Store the data from the register here
-  uint16_t registerByte_16; // Store the data from the register here
+  TMP102_WriteField(TMP102_FIELD_SD, 1);
+}
 
-  // Change pointer address to configuration register (0x01)
-  openPointerRegister(CONFIG_REGISTER);
-  
-  // Read current configuration register value
-   registerByte_16 = TMP102_ReadReg();
 
-  // Load new value for extention mode
-  registerByte_16 &= 0xFFEF;		// Clear EM (bit 4 of second byte)
-  registerByte_16 |= mode<<4;	// Shift in new exentended mode bit
+void tmp102_wakeup(void)
+{
+  TMP102_WriteField(TMP102_FIELD_SD, 0);
+}
+
 
-  // Set configuration registers
-  TMP102_WriteReg(CONFIG_REGISTER, registerByte_16);
+void setAlertPolarity(bool polarity)
+{
+  TMP102_WriteField(TMP102_FIELD_POL, polarity);
 }
 
 
-void tmp102_sleep(void)
+bool alert(void)
 {
-  uint8_t registerByte; // Store the data from the register here
-   uint16_t registerByte_16, ; // Store the data from the register here
+  uint8_t al = 0;	// a sensor that does not answer reports no alert
 
-  // Change pointer address to configuration register (0x01)
-  openPointerRegister(CONFIG_REGISTER);
-  
-  // Read current configuration register value
-	registerByte_16 = TMP102_ReadReg();
-  registerByte_16 |= 0x0100;	// Set SD (bit 0 of first byte)
+  TMP102_ReadField(TMP102_FIELD_AL, &al);
+  return (bool)al;
+}
 
- // Set configuration registers
-  TMP102_WriteReg(CONFIG_REGISTER, registerByte_16);
 
+void setFault(uint8_t faultSetting)
+{
+  TMP102_WriteField(TMP102_FIELD_F, faultSetting);
 }
 
 
-void tmp102_wakeup(void)
+void setAlertMode(bool mode)
 {
-  uint8_t registerByte; // Store the data from the register here
-  uint16_t registerByte_16; // Store the data from the register here
+  TMP102_WriteField(TMP102_FIELD_TM, mode);
+}
 
-  // Change pointer address to configuration register (1)
-  openPointerRegister(CONFIG_REGISTER);
-  
-  // Read current configuration register value
-   registerByte_16 = TMP102_ReadReg();
 
-  registerByte_16 &= 0xFEFF;	// Clear SD (bit 0 of first byte)
+uint8_t oneShot(bool setOneShot)
+{
+  uint8_t ready;
 
-  // Set configuration registers
-  TMP102_WriteReg(CONFIG_REGISTER, registerByte_16);
+  if(setOneShot)	//Enable one-shot by writing a 1 to the OS bit of the configuration register
+  {
+    TMP102_WriteField(TMP102_FIELD_OS, 1);
+    return 0;
+  }
+  //Return OS bit of configuration register (0-not ready, 1-conversion complete)
+  //a sensor that does not answer is never ready
+  ready = 0;
+  TMP102_ReadField(TMP102_FIELD_OS, &ready);
+  return ready;
 }
 
 
-void setAlertPolarity(bool polarity)
+/**
+  * @brief  Write an alert threshold in the format selected by EM.
+  * @param  RegName: T_LOW_REGISTER or T_HIGH_REGISTER.
+  * @param  counts: temperature in 1/16 degrees celcius, limited to -55C to +150C.
+  * @retval None
+  * @Note 	Nothing is written if EM cannot be read, the format would be a guess.
+  */
+static void setLimit(uint8_t RegName, int16_t counts)
 {
-  uint8_t registerByte; // Store the data from the register here
-  uint16_t registerByte_16, temp; // Store the data from the register here
+  bool extended;
 
-  // Change pointer address to configuration register (1)
-  openPointerRegister(CONFIG_REGISTER);
-  
-  // Read current configuration register value
-  registerByte_16 = TMP102_ReadReg();
+  // Prevent temperature from exceeding 150C or -55C
+  if(counts > 150*16)
+  {
+    counts = 150*16;
+  }
+  if(counts < -55*16)
+  {
+    counts = -55*16;
+  }
+  if (extendedMode(&extended) == SUCCESS)
+  {
+    TMP102_WriteReg(RegName, TMP102_CountsToReg(counts, extended));
+  }
+}
 
-  // Load new value for polarity
-  registerByte_16 &= 0xFBFF; // Clear POL (bit 2 of registerByte)
-  registerByte = (uint8_t)(registerByte_16 >> 8);
-  registerByte |= polarity<<2;  // Shift in new POL bit
-  
-  temp =  (uint16_t)registerByte << 8;  // Shift in new POL bit
-  registerByte_16 |=   temp;  // 
+/**
+  * @brief  Read an alert threshold in the format selected by EM.
+  * @param  RegName: T_LOW_REGISTER or T_HIGH_REGISTER.
+  * @retval temperature in 1/16 degrees celcius, TMP102_TEMP_INVALID if the sensor did not answer.
+  */
+static int16_t readLimit(uint8_t RegName)
+{
+  bool extended;
+  uint16_t registerByte_16;
 
-  // Set configuration registers
-  TMP102_WriteReg(CONFIG_REGISTER, registerByte_16);
+  if (extendedMode(&extended) != SUCCESS || TMP102_ReadRegAt(RegName, &registerByte_16) != SUCCESS)
+  {
+    return TMP102_TEMP_INVALID;
+  }
+  return TMP102_RegToCounts(registerByte_16, extended);
 }
 
 
-bool alert(void)
+void setLowTemp(int16_t counts)
 {
-  uint8_t registerByte; // Store the data from the register here
+  setLimit(T_LOW_REGISTER, counts);
+}
 
-  // Change pointer address to configuration register (1)
-  openPointerRegister(CONFIG_REGISTER);
-  
-  // Read current configuration register value
-  registerByte = readRegister(1);
-  
-  registerByte &= 0x20;	// Clear everything but the alert bit (bit 5)
-  return registerByte>>5;
+
+void setHighTemp(int16_t counts)
+{
+  setLimit(T_HIGH_REGISTER, counts);
+}
+
+
+int16_t readLowTemp(void)
+{
+  return readLimit(T_LOW_REGISTER);
+}
+
+
+int16_t readHighTemp(void)
+{
+  return readLimit(T_HIGH_REGISTER);
+}
+
+
+#ifndef TMP102_NO_FLOAT
+float readTempF(void)
+{
+	// From the unrounded counts, readTempC is in tenths
+	return TMP102_CountsToF(readTempRaw());
 }
 
 
 void setLowTempC(float temperature)
 {
-  uint8_t registerByte[2];	// Store the data from the register here
-  uint16_t registerByte_16, temp;
-  bool extendedMode;	// Store extended mode bit here 0:-55C to +128C, 1:-55C to +150C
-  
-  // Prevent temperature from exceeding 150C or -55C
+  // Clamp before converting so the count cannot overflow
   if(temperature > 150.0f)
   {
     temperature = 150.0f;
   }
-  if(temperature < -55.0)
+  if(temperature < -55.0f)
   {
     temperature = -55.0f;
   }
-  
-  //Check if temperature should be 12 or 13 bits
-  openPointerRegister(CONFIG_REGISTER);	// Read configuration register settings
-  
-  // Read current configuration register value
-  registerByte[0] = readRegister(0);
-  registerByte[1] = readRegister(1);
-  extendedMode = (registerByte[1]&0x10)>>4;	// 0 - temp data will be 12 bits
-                                            // 1 - temp data will be 13 bits
-
   // Convert analog temperature to digital value
-  temperature = temperature/0.0625;
-  
-  // Split temperature into separate bytes
-  if(extendedMode)	// 13-bit mode
-  {
-	registerByte[0] = ((int)temperature)>>5;
-    registerByte[1] = (((int)temperature)<<3);
-  }
-  else	// 12-bit mode
-  {
-	registerByte[0] = ((int)temperature)>>4;
-    registerByte[1] = ((int)temperature)<<4;
-  }
-  
-  // Write to T_LOW Register
-  registerByte_16 = registerByte[0];
-  registerByte_16 = registerByte_16 << 8;
-  registerByte_16 |= registerByte[1];
-  
-  TMP102_WriteReg(T_LOW_REGISTER, registerByte_16);
+  setLowTemp((int16_t)(temperature/0.0625f));
 }
 
 
 void setHighTempC(float temperature)
 {
-  uint8_t registerByte[2];	// Store the data from the register here
-  uint16_t registerByte_16, temp;
-  bool extendedMode;	// Store extended mode bit here 0:-55C to +128C, 1:-55C to +150C
-  
-  // Prevent temperature from exceeding 150C
   if(temperature > 150.0f)
   {
     temperature = 150.0f;
   }
-  if(temperature < -55.0)
+  if(temperature < -55.0f)
   {
     temperature = -55.0f;
   }
-  
-  // Check if temperature should be 12 or 13 bits
-  openPointerRegister(CONFIG_REGISTER);	// Read configuration register settings
-  
-  // Read current configuration register value
-  registerByte[0] = readRegister(0);
-  registerByte[1] = readRegister(1);
-  extendedMode = (registerByte[1]&0x10)>>4;	// 0 - temp data will be 12 bits
-                                            // 1 - temp data will be 13 bits
-
-  // Convert analog temperature to digital value
-  temperature = temperature/0.0625;
-  
-  // Split temperature into separate bytes
-  if(extendedMode)	// 13-bit mode
-  {
-	registerByte[0] = ((int)temperature)>>5;
-    registerByte[1] = (((int)temperature)<<3);
-  }
-  else	// 12-bit mode
-  {
-	registerByte[0] = ((int)temperature)>>4;
-    registerByte[1] =((int)temperature)<<4;
-  }
-  
-  // Write to T_HIGH Register
-   registerByte_16 = registerByte[0];
-  registerByte_16 = registerByte_16 << 8;
-  registerByte_16 |= registerByte[1];
-  
-  TMP102_WriteReg(T_LOW_REGISTER, registerByte_16);
+  setHighTemp((int16_t)(temperature/0.0625f));
 }
 
 
@@ -623,188 +564,24 @@ void setHighTempF(float temperature)
 
 float readLowTempC(void)
 {
-  uint8_t registerByte[2];	// Store the data from the register here
-  bool extendedMode;	// Store extended mode bit here 0:-55C to +128C, 1:-55C to +150C
-  int16_t digitalTemp;		// Store the digital temperature value here
-  float temperature;	// Store the analog temperature value here
-  
-  // Check if temperature should be 12 or 13 bits
-  openPointerRegister(CONFIG_REGISTER);	// Read configuration register settings
-  // Read current configuration register value
-  registerByte[0] = readRegister(0);
-  registerByte[1] = readRegister(1);
-  extendedMode = (registerByte[1]&0x10)>>4;	// 0 - temp data will be 12 bits
-                                            // 1 - temp data will be 13 bits
-  openPointerRegister(T_LOW_REGISTER);
-  registerByte[0] = readRegister(0);
-  registerByte[1] = readRegister(1);
-  
-  if(extendedMode)	// 13 bit mode
-  {
-	// Combine bytes to create a signed int
-    digitalTemp = ((registerByte[0]) << 5) | (registerByte[1] >> 3);
-	// Temperature data can be + or -, if it should be negative,
-	// convert 13 bit to 16 bit and use the 2s compliment.
-    if(digitalTemp > 0xFFF)
-	{
-      digitalTemp |= 0xE000;
-    }
-  }
-  else	// 12 bit mode
-  {
-	// Combine bytes to create a signed int 
-    digitalTemp = ((registerByte[0]) << 4) | (registerByte[1] >> 4);
-	// Temperature data can be + or -, if it should be negative,
-	// convert 12 bit to 16 bit and use the 2s compliment.
-    if(digitalTemp > 0x7FF)
-	{
-      digitalTemp |= 0xF000;
-    }
-  }
-  // Convert digital reading to analog temperature (1-bit is equal to 0.0625 C)
-  return digitalTemp*0.0625;
+  return TMP102_CountsToC(readLowTemp());
 }
 
 
 float readHighTempC(void)
 {
-  uint8_t registerByte[2];	// Store the data from the register here
-  bool extendedMode;	// Store extended mode bit here 0:-55C to +128C, 1:-55C to +150C
-  int16_t digitalTemp;		// Store the digital temperature value here
-  float temperature;	// Store the analog temperature value here
-  
-  // Check if temperature should be 12 or 13 bits
-  openPointerRegister(CONFIG_REGISTER);	// read configuration register settings
-  // Read current configuration register value
-  registerByte[0] = readRegister(0);
-  registerByte[1] = readRegister(1);
-  extendedMode = (registerByte[1]&0x10)>>4;	// 0 - temp data will be 12 bits
-											// 1 - temp data will be 13 bits
-  openPointerRegister(T_HIGH_REGISTER);
-  registerByte[0] = readRegister(0);
-  registerByte[1] = readRegister(1);
-  
-  if(extendedMode)	// 13 bit mode
-  {
-	// Combine bytes to create a signed int
-    digitalTemp = ((registerByte[0]) << 5) | (registerByte[1] >> 3);
-	// Temperature data can be + or -, if it should be negative,
-	// convert 13 bit to 16 bit and use the 2s compliment.
-    if(digitalTemp > 0xFFF)
-	{
-      digitalTemp |= 0xE000;
-    }
-  }
-  else	// 12 bit mode
-  {
-	// Combine bytes to create a signed int 
-    digitalTemp = ((registerByte[0]) << 4) | (registerByte[1] >> 4);
-	// Temperature data can be + or -, if it should be negative,
-	// convert 12 bit to 16 bit and use the 2s compliment.
-    if(digitalTemp > 0x7FF)
-	{
-      digitalTemp |= 0xF000;
-    }
-  }
-  // Convert digital reading to analog temperature (1-bit is equal to 0.0625 C)
-  return digitalTemp*0.0625;
+  return TMP102_CountsToC(readHighTemp());
 }
 
 
 float readLowTempF(void)
 {
-  return readLowTempC()*9.0/5.0 + 32.0;
+  return TMP102_CountsToF(readLowTemp());
 }
 
 
 float readHighTempF(void)
 {
-  return readHighTempC()*9.0/5.0 + 32.0;
-}
-
-
-void setFault(uint8_t faultSetting)
-{
-  uint8_t registerByte; // Store the data from the register here
-  uint16_t registerByte_16, temp;
-
-  faultSetting = faultSetting&3; // Make sure rate is not set higher than 3.
-  
-  // Change pointer address to configuration register (0x01)
-  openPointerRegister(CONFIG_REGISTER);
-  
-  // Read current configuration register value
-  registerByte_16 = TMP102_ReadReg();
-  registerByte_16 &= 0xE7FF;  // Clear F0/1 (bit 3 and 4 of first byte)
-  temp = registerByte_16;
-  temp = temp >> 8;
-  registerByte = temp;
-
-  // Load new conversion rate
-  //registerByte &= 0xE7;  // Clear F0/1 (bit 3 and 4 of first byte)
-  registerByte |= faultSetting<<3;	// Shift new fault setting
-
-  // Set configuration registers
-  temp = registerByte;
-  temp = temp << 8;
-  registerByte_16 |= temp;
-  
-  TMP102_WriteReg(T_LOW_REGISTER, registerByte_16);
-}
-
-
-void setAlertMode(bool mode)
-{
-  uint8_t registerByte; // Store the data from the register here
-  int16_t registerByte_16, temp;
-  
-  // Change pointer address to configuration register (1)
-  openPointerRegister(CONFIG_REGISTER);
-  
-  // Read current configuration register value
-  //registerByte = readRegister(0);
-   // Read current configuration register value
-  registerByte_16 = TMP102_ReadReg();
-  registerByte_16 &= 0xFDFF;	// Clear old TM bit (bit 1 of first byte)
-  temp = registerByte_16;
-  temp = temp >> 8;
-  registerByte = temp;
-
-  // Load new conversion rate
-  //registerByte &= 0xFD;	// Clear old TM bit (bit 1 of first byte)
-  registerByte |= mode<<1;	// Shift in new TM bit
-
-  // Set configuration registers
-  temp = registerByte;
-  temp = temp << 8;
-  registerByte_16 |= temp;
-  
-  TMP102_WriteReg(T_LOW_REGISTER, registerByte_16);
-}
-
-uint8_t oneShot(bool setOneShot)
-{
-  uint8_t registerByte; //Store the data from the register here
-  uint16_t registerByte_16, temp;
-
-  //Read the first byte of the configuration register
-  openPointerRegister(CONFIG_REGISTER);
-	registerByte_16 = TMP102_ReadReg();
-  
-  if(setOneShot)	//Enable one-shot by writing a 1 to the OS bit of the configuration register
-  {
-    registerByte_16 |= (1<<15);
-	
-	// Set configuration register
-  TMP102_WriteReg(CONFIG_REGISTER, registerByte_16);
-	return 0;
-  }
-  else	//Return OS bit of configuration register (0-not ready, 1-conversion complete)
-  {
-		
-		openPointerRegister(TEMPERATURE_REGISTER);//point to temperature reg
-		registerByte_16 &= (1<<15);
-    registerByte = (registerByte_16>>15);
-    return registerByte;
-  }
+  return TMP102_CountsToF(readHighTemp());
 }
+#endif /* TMP102_NO_FLOAT */
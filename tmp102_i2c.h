@@ -19,6 +19,8 @@
 /* Includes ------------------------------------------------------------------*/
 #include "stm8l15x.h" 
 #include "config.h"
+#include "tmp102_bus.h"
+#include "tmp102_codec.h"
 
 /* Private typedef -----------------------------------------------------------*/
 /* Private define ------------------------------------------------------------*/
@@ -33,18 +35,55 @@
 #define T_HIGH_REGISTER 0x03
 #define I2C_TIMEOUT         (uint32_t)0x3FFFF /*!< I2C Time out */
 #define TMP102_ADDR           0x90 /*!< Address of Temperature sensor (0x48,0x49,0x4A,0x4B) << 1*/
+#define TMP102_ADDR_GND       0x90 /*!< ADD0 to GND */
+#define TMP102_ADDR_VCC       0x92 /*!< ADD0 to V+ */
+#define TMP102_ADDR_SDA       0x94 /*!< ADD0 to SDA */
+#define TMP102_ADDR_SCL       0x96 /*!< ADD0 to SCL */
 #define TMP102_I2C_SPEED      100000 /*!< I2C Speed */
 
+/**
+  * @brief  Configuration register fields, see TMP102_ReadField/TMP102_WriteField
+  */
+#define TMP102_FIELD_EM       0 /*!< Extended mode */
+#define TMP102_FIELD_AL       1 /*!< Alert, read only */
+#define TMP102_FIELD_CR       2 /*!< Conversion rate (0-3) */
+#define TMP102_FIELD_SD       3 /*!< Shutdown mode */
+#define TMP102_FIELD_TM       4 /*!< Thermostat mode */
+#define TMP102_FIELD_POL      5 /*!< Alert polarity */
+#define TMP102_FIELD_F        6 /*!< Consecutive faults (0-3) */
+#define TMP102_FIELD_OS       7 /*!< One-shot / conversion ready */
+
 /* Private macro -------------------------------------------------------------*/
 /* Private function prototypes -----------------------------------------------*/
+	void TMP102_SelectDevice(uint8_t Address);	// Sensor addressed by the calls below (default TMP102_ADDR)
 	ErrorStatus TMP102_GetStatus(void); // Checks the TMP102 status
+	ErrorStatus TMP102_Transfer(TMP102_BusStep *Steps, uint8_t NumStep);	// Runs bus steps as one unit
+	void TMP102_SetStep(TMP102_BusStep *Step, uint8_t Address, uint8_t *pBuffer, uint8_t NumByte);
 	void TMP102_reset(void);	//reset registers
-	void TMP102_WriteReg(uint8_t RegName, uint16_t RegValue);
-	int16_t readTempC(void);	// Returns the temperature in degrees C
-	float readTempF(void);	// Converts readTempC result to degrees F
+	ErrorStatus TMP102_WriteReg(uint8_t RegName, uint16_t RegValue);
+	ErrorStatus TMP102_ReadReg(uint16_t *Value);	// Reads the register selected by the pointer register
+	ErrorStatus TMP102_ReadRegAt(uint8_t RegName, uint16_t *Value);	// Reads any register, pointer goes back to temperature
+	int16_t readTempC(void);	// Returns the temperature in 0.1 degrees C
+	int16_t readTempRaw(void);	// Returns the temperature in 1/16 degrees C
+	ErrorStatus readTempRawEx(int16_t *counts);	// As readTempRaw, ERROR if the sensor did not answer
 	void tmp102_sleep(void);	// Switch sensor to low power mode
 	void tmp102_wakeup(void);	// Wakeup and start running in normal power mode
 	bool alert(void);	// Returns state of Alert register
+	void setLowTemp(int16_t counts);	// Sets T_LOW (1/16 degrees C) alert threshold
+	void setHighTemp(int16_t counts);	// Sets T_HIGH (1/16 degrees C) alert threshold
+	int16_t readLowTemp(void);	// Reads T_LOW register in 1/16 degrees C
+	int16_t readHighTemp(void);	// Reads T_HIGH register in 1/16 degrees C
+
+	// Register codec shared by every setter, conversions are in tmp102_codec.h
+	uint16_t TMP102_FieldInsert(uint16_t RegValue, uint8_t Field, uint8_t Value);
+	uint8_t TMP102_FieldExtract(uint16_t RegValue, uint8_t Field);
+	ErrorStatus TMP102_ReadField(uint8_t Field, uint8_t *Value);	// Reads one configuration register field
+	ErrorStatus TMP102_WriteField(uint8_t Field, uint8_t Value);	// Read-modify-write, no write if the read fails
+
+	// Define TMP102_NO_FLOAT for builds without soft-float, only the integer API remains
+	// The float readers return -2048 C (TMP102_TEMP_INVALID counts) if the sensor did not answer
+#ifndef TMP102_NO_FLOAT
+	float readTempF(void);	// Returns the temperature in degrees F
 	void setLowTempC(float temperature);  // Sets T_LOW (degrees C) alert threshold
 	void setHighTempC(float temperature); // Sets T_HIGH (degrees C) alert threshold
 	void setLowTempF(float temperature);  // Sets T_LOW (degrees F) alert threshold
@@ -53,6 +92,7 @@
 	float readHighTempC(void);	// Reads T_HIGH register in C
 	float readLowTempF(void);	// Reads T_LOW register in F
 	float readHighTempF(void);	// Reads T_HIGH register in F		
+#endif
 	
 	// Set the conversion rate (0-3)
 	// 0 - 0.25 Hz
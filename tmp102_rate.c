@@ -0,0 +1,206 @@
+/**
+  ******************************************************************************
+  * @file    tmp102_rate.c
+  * @author  Ngonidzashe Gwata
+  * @version V1.1.1
+  * @date    18-October-2026
+  * @brief   This file provides an adaptive conversion rate controller.
+  *          It measures how fast the temperature moves over the last
+  *          TMP102_RATE_WINDOW samples and steps the CR bits up one level when
+  *          the slope reaches RiseSlope, down one level when it falls to
+  *          FallSlope. Keeping FallSlope below RiseSlope, and refilling the
+  *          window after every change, stops the rate from flapping.
+  *          A change rewrites only the CR field, read-modify-write, so the
+  *          other configuration bits stay whatever the application last set
+  *          them to. Each controller keeps the address of its own sensor and
+  *          selects it before touching the bus.
+  *          Dwell times start in ms; whenever one would pass
+  *          TMP102_RATE_DWELL_MAX all four are halved and the unit doubles,
+  *          so the effective rate stays the average since Init for as long
+  *          as the controller runs.
+  ******************************************************************************
+ */
+
+#include "tmp102_rate.h"
+
+/* Conversion rate of each CR setting in mHz */
+static const uint16_t RateMilliHz[4] = {250, 1000, 4000, 8000};
+
+static void Rate_Push(TMP102_RateController *ctrl, int16_t raw, uint32_t now)
+{
+  ctrl->Sample[ctrl->Head] = raw;
+  ctrl->Time[ctrl->Head] = now;
+  ctrl->Head = (uint8_t)((ctrl->Head + 1) % TMP102_RATE_WINDOW);
+  if (ctrl->Count < TMP102_RATE_WINDOW)
+  {
+    ctrl->Count++;
+  }
+}
+
+/**
+  * @brief  Charge elapsed ms to the current rate, halving every dwell first
+  *         if the current one would pass TMP102_RATE_DWELL_MAX.
+  */
+static void Rate_AddDwell(TMP102_RateController *ctrl, uint32_t elapsed)
+{
+  uint32_t mask = ((uint32_t)1 << ctrl->DwellShift) - 1;
+  uint32_t part = (elapsed & mask) + ctrl->DwellPart;
+  uint32_t units = (elapsed >> ctrl->DwellShift) + (part >> ctrl->DwellShift);
+  uint8_t i;
+
+  ctrl->DwellPart = part & mask;
+  while (units > TMP102_RATE_DWELL_MAX - ctrl->Dwell[ctrl->Rate])
+  {
+    for (i = 0; i < 4; i++)
+    {
+      ctrl->Dwell[i] >>= 1;
+    }
+    units >>= 1;
+    ctrl->DwellShift++;
+  }
+  ctrl->Dwell[ctrl->Rate] += units;
+}
+
+/**
+  * @brief  Initialise the controller and program the starting rate.
+  * @param  Address: sensor driven by this controller, as for TMP102_SelectDevice.
+  * @param  rate: starting conversion rate (0-3), see setConversionRate.
+  * @param  riseSlope: slope in 1/16 C per second at which the rate goes up.
+  * @param  fallSlope: slope in 1/16 C per second at which the rate goes down,
+  *         must be lower than riseSlope.
+  * @retval ERROR if the configuration register could not be read or written,
+  *         the sensor is then left as it was.
+  * @Note 	Address stays selected afterwards, as after TMP102_SelectDevice.
+  */
+ErrorStatus TMP102_Rate_Init(TMP102_RateController *ctrl, uint8_t Address, uint8_t rate,
+                             uint16_t riseSlope, uint16_t fallSlope)
+{
+  uint8_t i;
+
+  for (i = 0; i < 4; i++)
+  {
+    ctrl->Dwell[i] = 0;
+  }
+  ctrl->DwellPart = 0;
+  ctrl->DwellShift = 0;
+  ctrl->Head = 0;
+  ctrl->Count = 0;
+  ctrl->RiseSlope = riseSlope;
+  ctrl->FallSlope = fallSlope;
+  ctrl->Rate = rate & 0x03;
+  ctrl->Address = Address;
+
+  TMP102_SelectDevice(Address);
+  return TMP102_WriteField(TMP102_FIELD_CR, ctrl->Rate);
+}
+
+/**
+  * @brief  Add a sample and adjust the conversion rate if needed.
+  * @param  raw: temperature in 1/16 C as returned by readTempRaw,
+  *         TMP102_TEMP_INVALID samples are ignored.
+  * @param  now: time the sample was taken, ms, free running.
+  * @retval conversion rate (0-3) in effect after this sample.
+  * @Note 	A rate change selects the controller's sensor, which stays selected.
+  *         If the write fails the sensor keeps its old rate and so does the
+  *         controller, the next sample tries again.
+  */
+uint8_t TMP102_Rate_Update(TMP102_RateController *ctrl, int16_t raw, uint32_t now)
+{
+  int32_t delta;
+  uint32_t span, slope;
+  uint8_t oldest, rate;
+
+  if (raw == TMP102_TEMP_INVALID)
+  {
+    return ctrl->Rate;
+  }
+
+  if (ctrl->Count)
+  {
+    Rate_AddDwell(ctrl, now - ctrl->LastTick);
+  }
+  ctrl->LastTick = now;
+
+  Rate_Push(ctrl, raw, now);
+  if (ctrl->Count < TMP102_RATE_WINDOW)
+  {
+    return ctrl->Rate;
+  }
+
+  // Window is full, Head now points to the oldest sample
+  oldest = ctrl->Head;
+  span = now - ctrl->Time[oldest];
+  if (span == 0)
+  {
+    return ctrl->Rate;
+  }
+  delta = (int32_t)raw - ctrl->Sample[oldest];
+  if (delta < 0)
+  {
+    delta = -delta;
+  }
+  slope = ((uint32_t)delta * 1000) / span;	// 1/16 C per second
+
+  if (slope >= ctrl->RiseSlope && ctrl->Rate < 3)
+  {
+    rate = (uint8_t)(ctrl->Rate + 1);
+  }
+  else if (slope <= ctrl->FallSlope && ctrl->Rate > 0)
+  {
+    rate = (uint8_t)(ctrl->Rate - 1);
+  }
+  else
+  {
+    return ctrl->Rate;
+  }
+
+  // Only CR changes, shutdown, mode, polarity and faults are left alone
+  TMP102_SelectDevice(ctrl->Address);
+  if (TMP102_WriteField(TMP102_FIELD_CR, rate) != SUCCESS)
+  {
+    return ctrl->Rate;
+  }
+  ctrl->Rate = rate;
+
+  // Start a new window at the new rate, keeping only this sample
+  ctrl->Head = 0;
+  ctrl->Count = 0;
+  Rate_Push(ctrl, raw, now);
+  return ctrl->Rate;
+}
+
+/**
+  * @brief  Time weighted average of the conversion rate since Init.
+  * @param  None
+  * @retval rate in mHz.
+  * @Note 	Rate_AddDwell keeps each dwell within TMP102_RATE_DWELL_MAX, so
+  *         their total fits 32 bits, and each is scaled to a 1/1024 share of
+  *         the total first so the weighted sum does too.
+  */
+uint16_t TMP102_Rate_GetEffectiveRate(const TMP102_RateController *ctrl)
+{
+  uint32_t total = 0, scale, share, weight = 0, sum = 0;
+  uint8_t i;
+
+  for (i = 0; i < 4; i++)
+  {
+    total += ctrl->Dwell[i];
+  }
+  if (total == 0)
+  {
+    return RateMilliHz[ctrl->Rate];
+  }
+
+  scale = (total >> 10) + 1;
+  for (i = 0; i < 4; i++)
+  {
+    share = ctrl->Dwell[i] / scale;
+    weight += share;
+    sum += share * RateMilliHz[i];
+  }
+  if (weight == 0)
+  {
+    return RateMilliHz[ctrl->Rate];
+  }
+  return (uint16_t)(sum / weight);
+}
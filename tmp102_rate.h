@@ -0,0 +1,60 @@
+/**
+  ******************************************************************************
+  * @file    tmp102_rate.h
+  * @author  Ngonidzashe Gwata
+  * @version V1.1.1
+  * @date    18-October-2026
+  * @brief   This file contains all the functions prototypes for the
+  *          adaptive conversion rate controller.
+  ******************************************************************************
+  *
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __TMP102_RATE_H
+#define __TMP102_RATE_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "tmp102_i2c.h"
+
+/* Private define ------------------------------------------------------------*/
+#define TMP102_RATE_WINDOW			4	/*!< Samples the slope is measured over */
+#define TMP102_RATE_RISE_DEFAULT	8	/*!< 0.5 C/s, step the rate up at or above this */
+#define TMP102_RATE_FALL_DEFAULT	2	/*!< 0.125 C/s, step the rate down at or below this */
+#define TMP102_RATE_DWELL_MAX		0x3FFFFFFFUL	/*!< Dwell units before all four are halved, keeps their sum in 32 bits */
+
+/* Private typedef -----------------------------------------------------------*/
+/**
+  * @brief  Controller state, one per sensor.
+  */
+typedef struct
+{
+  int16_t Sample[TMP102_RATE_WINDOW];	/*!< Recent readings, 1/16 C */
+  uint32_t Time[TMP102_RATE_WINDOW];	/*!< When each reading was taken, ms */
+  uint32_t Dwell[4];		/*!< Time spent at each conversion rate, 2^DwellShift ms units */
+  uint32_t DwellPart;		/*!< ms short of a whole dwell unit */
+  uint32_t LastTick;
+  uint16_t RiseSlope;		/*!< 1/16 C per second */
+  uint16_t FallSlope;		/*!< 1/16 C per second, below RiseSlope */
+  uint8_t Address;			/*!< Sensor this controller drives, see TMP102_SelectDevice */
+  uint8_t Head;
+  uint8_t Count;
+  uint8_t Rate;				/*!< CR bits currently programmed (0-3) */
+  uint8_t DwellShift;		/*!< Times the dwell unit has doubled */
+} TMP102_RateController;
+
+/* Private macro -------------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+	// Bind the controller to the sensor at Address and program the starting rate (0-3)
+	ErrorStatus TMP102_Rate_Init(TMP102_RateController *ctrl, uint8_t Address, uint8_t rate,
+	                             uint16_t riseSlope, uint16_t fallSlope);
+
+	// Feed a readTempRaw() sample taken at now (ms), returns the rate in effect
+	uint8_t TMP102_Rate_Update(TMP102_RateController *ctrl, int16_t raw, uint32_t now);
+
+	// Average sample rate since Init in mHz (250 - 8000)
+	uint16_t TMP102_Rate_GetEffectiveRate(const TMP102_RateController *ctrl);
+
+#endif /* __TMP102_RATE_H */
@@ -0,0 +1,205 @@
+/**
+  ******************************************************************************
+  * @file    tmp102_replay.c
+  * @author  Ngonidzashe Gwata
+  * @version V1.1.1
+  * @date    18-October-2026
+  * @brief   This file provides a bus backend for Linux hosts that plays a
+  *          capture log (see tmp102_capture.h) back through the driver.
+  *          Build the driver with TMP102_BUS_REPLAY and this file in place
+  *          of tmp102_bus_hw.c, with host/ first on the include path for
+  *          its stand-in stm8l15x.h and config.h. tools/tmp102_replay_run.c
+  *          drives the driver over a log and prints the statistics.
+  *          Each transfer the driver issues consumes the next record: reads
+  *          return the recorded bytes and status, writes return the recorded
+  *          status and are compared byte for byte. The statistics then show
+  *          where the driver's traffic diverges from the field unit's and how
+  *          the transfer count compares. A log cut short by a full capture
+  *          buffer carries its dropped count; that many transfers past its
+  *          end are counted as Unlogged, not Extra, since the log cannot say
+  *          what they were.
+  ******************************************************************************
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include "tmp102_replay.h"
+
+#ifdef TMP102_BUS_REPLAY
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+static uint8_t *Log;
+static long LogLength;
+static long LogOffset;
+static uint32_t TicksPerSecond;
+static uint32_t LastTick;
+static bool Paced;
+static TMP102_ReplayStats Stats;
+
+static uint32_t Replay_Get32(const uint8_t *p)
+{
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+/**
+  * @brief  Count the records, rejecting a log with a truncated record.
+  */
+static ErrorStatus Replay_Scan(void)
+{
+  long offset = TMP102_CAPTURE_HEADER_SIZE;
+
+  Stats.Records = 0;
+  while (offset < LogLength)
+  {
+    if (offset + TMP102_CAPTURE_RECORD_SIZE > LogLength ||
+        offset + TMP102_CAPTURE_RECORD_SIZE + Log[offset + 6] > LogLength)
+    {
+      return ERROR;
+    }
+    offset += TMP102_CAPTURE_RECORD_SIZE + Log[offset + 6];
+    Stats.Records++;
+  }
+  return SUCCESS;
+}
+
+/**
+  * @brief  Load a capture log.
+  * @param  path: log file written from a TMP102_Capture_Start buffer.
+  * @param  RealTime: TRUE to sleep out the recorded time between transfers.
+  * @retval ERROR if the file cannot be read or is not a capture log.
+  */
+ErrorStatus TMP102_Replay_Open(const char *path, bool RealTime)
+{
+  FILE *file;
+
+  TMP102_Replay_Close();
+  file = fopen(path, "rb");
+  if (file == NULL)
+  {
+    return ERROR;
+  }
+  fseek(file, 0, SEEK_END);
+  LogLength = ftell(file);
+  fseek(file, 0, SEEK_SET);
+  if (LogLength >= TMP102_CAPTURE_HEADER_SIZE)
+  {
+    Log = (uint8_t *)malloc((size_t)LogLength);
+  }
+  if (Log == NULL || fread(Log, 1, (size_t)LogLength, file) != (size_t)LogLength)
+  {
+    fclose(file);
+    TMP102_Replay_Close();
+    return ERROR;
+  }
+  fclose(file);
+
+  if (memcmp(Log, "T102", 4) != 0 || Log[4] != TMP102_CAPTURE_VERSION ||
+      Replay_Scan() != SUCCESS)
+  {
+    TMP102_Replay_Close();
+    return ERROR;
+  }
+  Stats.Remaining = Stats.Records;
+  Stats.Dropped = (uint32_t)Log[TMP102_CAPTURE_DROPPED] | ((uint32_t)Log[TMP102_CAPTURE_DROPPED + 1] << 8);
+  TicksPerSecond = Replay_Get32(&Log[8]);
+  Paced = RealTime;
+  LogOffset = TMP102_CAPTURE_HEADER_SIZE;
+  if (LogOffset < LogLength)
+  {
+    LastTick = Replay_Get32(&Log[LogOffset]);
+  }
+  return SUCCESS;
+}
+
+void TMP102_Replay_GetStats(TMP102_ReplayStats *stats)
+{
+  *stats = Stats;
+}
+
+void TMP102_Replay_Close(void)
+{
+  free(Log);
+  Log = NULL;
+  LogLength = 0;
+  LogOffset = 0;
+  memset(&Stats, 0, sizeof(Stats));
+}
+
+/**
+  * @brief  Take the next record for a transfer, pacing it if asked to.
+  * @retval the record, or NULL once the log has run out.
+  */
+static const uint8_t *Replay_Next(uint8_t Address, uint8_t NumByte)
+{
+  const uint8_t *record;
+  uint32_t tick, gap;
+  struct timespec delay;
+
+  Stats.Transfers++;
+  if (Log == NULL || LogOffset >= LogLength)
+  {
+    if (Stats.Unlogged < Stats.Dropped)
+    {
+      Stats.Unlogged++;
+    }
+    else
+    {
+      Stats.Extra++;
+    }
+    return NULL;
+  }
+  record = &Log[LogOffset];
+  LogOffset += TMP102_CAPTURE_RECORD_SIZE + record[6];
+  Stats.Remaining--;
+
+  tick = Replay_Get32(record);
+  if (Paced && TicksPerSecond)
+  {
+    gap = tick - LastTick;
+    delay.tv_sec = gap / TicksPerSecond;
+    delay.tv_nsec = (long)((uint64_t)(gap % TicksPerSecond) * 1000000000UL / TicksPerSecond);
+    nanosleep(&delay, NULL);
+  }
+  LastTick = tick;
+
+  if (record[4] != Address || record[6] != NumByte)
+  {
+    Stats.Mismatches++;
+  }
+  return record;
+}
+
+ErrorStatus TMP102_BUS_WRITE_FN(uint8_t Address, const uint8_t *pBuffer, uint8_t NumByte)
+{
+  const uint8_t *record = Replay_Next(Address & 0xFE, NumByte);
+
+  if (record == NULL)
+  {
+    return ERROR;
+  }
+  if (record[4] == (Address & 0xFE) && record[6] == NumByte &&
+      memcmp(record + TMP102_CAPTURE_RECORD_SIZE, pBuffer, NumByte) != 0)
+  {
+    Stats.Mismatches++;
+  }
+  return (record[5] & TMP102_CAPTURE_ACK) ? SUCCESS : ERROR;
+}
+
+ErrorStatus TMP102_BUS_READ_FN(uint8_t Address, uint8_t *pBuffer, uint8_t NumByte)
+{
+  const uint8_t *record = Replay_Next(Address | TMP102_BUS_READ, NumByte);
+
+  if (record == NULL)
+  {
+    return ERROR;
+  }
+  memcpy(pBuffer, record + TMP102_CAPTURE_RECORD_SIZE,
+         (record[6] < NumByte) ? record[6] : NumByte);
+  return (record[5] & TMP102_CAPTURE_ACK) ? SUCCESS : ERROR;
+}
+
+#endif /* TMP102_BUS_REPLAY */
@@ -0,0 +1,45 @@
+/**
+  ******************************************************************************
+  * @file    tmp102_replay.h
+  * @author  Ngonidzashe Gwata
+  * @version V1.1.1
+  * @date    18-October-2026
+  * @brief   This file contains all the functions prototypes for replaying a
+  *          bus capture through the driver on a host.
+  ******************************************************************************
+  *
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __TMP102_REPLAY_H
+#define __TMP102_REPLAY_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "tmp102_capture.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/**
+  * @brief  Comparison of the driver's traffic against the log.
+  */
+typedef struct
+{
+  uint32_t Records;		/*!< Records in the log */
+  uint32_t Transfers;	/*!< Transfers the driver issued */
+  uint32_t Mismatches;	/*!< Address, length or written bytes differ from the record */
+  uint32_t Extra;		/*!< Transfers issued after the log ran out, beyond Dropped */
+  uint32_t Remaining;	/*!< Records the driver never reached */
+  uint32_t Dropped;		/*!< Transfers the unit made after its capture buffer filled */
+  uint32_t Unlogged;	/*!< Transfers past the end of a cut short log, up to Dropped */
+} TMP102_ReplayStats;
+
+/* Private define ------------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+	// Load a capture log, RealTime reproduces the recorded gaps between transfers
+	ErrorStatus TMP102_Replay_Open(const char *path, bool RealTime);
+	void TMP102_Replay_GetStats(TMP102_ReplayStats *stats);
+	void TMP102_Replay_Close(void);
+
+#endif /* __TMP102_REPLAY_H */
@@ -0,0 +1,217 @@
+/**
+  ******************************************************************************
+  * @file    tmp102_shm.c
+  * @author  Ngonidzashe Gwata
+  * @version V1.1.1
+  * @date    18-October-2026
+  * @brief   This file provides a POSIX shared memory table holding the latest
+  *          reading of every device, for Linux hosts where several processes
+  *          want current temperatures without polling the sensors themselves.
+  *          The polling daemon is the only writer. Each slot is a seqlock:
+  *          the sequence is made odd, the value and timestamp stored, then
+  *          the sequence made even again. A reader copies the slot between
+  *          two loads of the sequence and retries if they differ or are odd,
+  *          so a snapshot costs a few loads from the mapping, with no lock,
+  *          syscall or copy through the kernel, however many readers attach.
+  *          Every field is accessed atomically, so torn reads cannot occur
+  *          even in the retried copies. tools/tmp102_shmbench.c measures the
+  *          read cost.
+  *
+  *          The object is never resized once created: a smaller object would
+  *          make readers that mapped the old size fault (SIGBUS), so Create
+  *          refuses an existing table of another size. Unlink it first.
+  ******************************************************************************
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include "tmp102_shm.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Slots are read from another process through a plain mapping: the atomics must
+// be address free plain loads and stores, and the layout must match everywhere
+_Static_assert(ATOMIC_INT_LOCK_FREE == 2 && sizeof(atomic_uint_least32_t) == 4,
+               "32-bit atomics must be lock free for a shared mapping");
+_Static_assert(sizeof(TMP102_ShmSlot) == 64, "slot must fill one cache line");
+
+static size_t Shm_Size(uint32_t devices)
+{
+  return offsetof(TMP102_ShmTable, Slot) + (size_t)devices * sizeof(TMP102_ShmSlot);
+}
+
+/**
+  * @brief  Create the table, or take over an existing one of the same size.
+  * @param  name: shm_open name, e.g. "/tmp102".
+  * @param  devices: number of slots.
+  * @param  map: receives the mapping.
+  * @retval 1 on success, 0 on failure or if a table of another size exists.
+  */
+int TMP102_Shm_Create(const char *name, uint32_t devices, TMP102_ShmMap *map)
+{
+  TMP102_ShmTable *table;
+  size_t size = Shm_Size(devices);
+  struct stat info;
+  uint32_t i;
+  int fd;
+
+  fd = shm_open(name, O_CREAT | O_RDWR, 0644);
+  if (fd < 0)
+  {
+    return 0;
+  }
+  if (fstat(fd, &info) != 0 ||
+      (info.st_size != 0 && (size_t)info.st_size != size) ||
+      (info.st_size == 0 && ftruncate(fd, (off_t)size) != 0))
+  {
+    close(fd);
+    return 0;
+  }
+  table = (TMP102_ShmTable *)mmap(0, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if (table == MAP_FAILED)
+  {
+    return 0;
+  }
+
+  table->Magic = 0;
+  for (i = 0; i < devices; i++)
+  {
+    atomic_init(&table->Slot[i].Sequence, 0);
+    atomic_init(&table->Slot[i].Value, (uint32_t)TMP102_SHM_EMPTY << 16);
+    atomic_init(&table->Slot[i].TimeLow, 0);
+    atomic_init(&table->Slot[i].TimeHigh, 0);
+  }
+  table->Devices = devices;
+  table->Size = (uint32_t)size;
+  table->Version = TMP102_SHM_VERSION;
+  // Magic last: readers attaching meanwhile see an incomplete table and fail
+  atomic_thread_fence(memory_order_release);
+  table->Magic = TMP102_SHM_MAGIC;
+
+  map->Table = table;
+  map->Length = size;
+  map->Devices = devices;
+  return 1;
+}
+
+/**
+  * @brief  Publish the latest reading of a device.
+  * @param  raw: temperature in 1/16 C as returned by readTempRawEx.
+  * @param  status: TMP102_SHM_OK, or TMP102_SHM_NO_RESPONSE when readTempRawEx
+  *         returned ERROR, raw is then the last good value.
+  * @param  timestamp: time of the reading, ns.
+  * @retval None
+  */
+void TMP102_Shm_Publish(const TMP102_ShmMap *map, uint32_t device,
+                        int16_t raw, uint8_t status, uint64_t timestamp)
+{
+  TMP102_ShmSlot *slot;
+  uint32_t seq;
+
+  if (device >= map->Devices)
+  {
+    return;
+  }
+  slot = &map->Table->Slot[device];
+
+  seq = atomic_load_explicit(&slot->Sequence, memory_order_relaxed);
+  atomic_store_explicit(&slot->Sequence, seq + 1, memory_order_relaxed);
+  atomic_thread_fence(memory_order_release);
+  atomic_store_explicit(&slot->Value, ((uint32_t)status << 16) | (uint16_t)raw,
+                        memory_order_relaxed);
+  atomic_store_explicit(&slot->TimeLow, (uint32_t)timestamp, memory_order_relaxed);
+  atomic_store_explicit(&slot->TimeHigh, (uint32_t)(timestamp >> 32), memory_order_relaxed);
+  atomic_store_explicit(&slot->Sequence, seq + 2, memory_order_release);
+}
+
+/**
+  * @brief  Map an existing table read only.
+  * @param  name: name given to TMP102_Shm_Create.
+  * @param  map: receives the mapping.
+  * @retval 1 on success, 0 if it does not exist or is not a TMP102 table.
+  */
+int TMP102_Shm_Attach(const char *name, TMP102_ShmMap *map)
+{
+  const TMP102_ShmTable *table;
+  struct stat info;
+  size_t length;
+  int fd;
+
+  fd = shm_open(name, O_RDONLY, 0);
+  if (fd < 0)
+  {
+    return 0;
+  }
+  if (fstat(fd, &info) != 0 || (size_t)info.st_size < Shm_Size(0))
+  {
+    close(fd);
+    return 0;
+  }
+  length = (size_t)info.st_size;
+  table = (const TMP102_ShmTable *)mmap(0, length, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (table == MAP_FAILED)
+  {
+    return 0;
+  }
+  if (table->Magic != TMP102_SHM_MAGIC || table->Version != TMP102_SHM_VERSION ||
+      Shm_Size(table->Devices) > length)
+  {
+    munmap((void *)table, length);
+    return 0;
+  }
+  atomic_thread_fence(memory_order_acquire);
+
+  map->Table = (TMP102_ShmTable *)table;
+  map->Length = length;
+  map->Devices = table->Devices;
+  return 1;
+}
+
+/**
+  * @brief  Take a consistent snapshot of one device.
+  * @param  sample: receives the reading, status and timestamp.
+  * @retval 1 on success, 0 if device is out of range.
+  */
+int TMP102_Shm_Read(const TMP102_ShmMap *map, uint32_t device, TMP102_ShmSample *sample)
+{
+  TMP102_ShmSlot *slot;
+  uint32_t before, after, value, low, high;
+
+  if (device >= map->Devices)
+  {
+    return 0;
+  }
+  slot = &map->Table->Slot[device];
+
+  do
+  {
+    before = atomic_load_explicit(&slot->Sequence, memory_order_acquire);
+    value = atomic_load_explicit(&slot->Value, memory_order_relaxed);
+    low = atomic_load_explicit(&slot->TimeLow, memory_order_relaxed);
+    high = atomic_load_explicit(&slot->TimeHigh, memory_order_relaxed);
+    atomic_thread_fence(memory_order_acquire);
+    after = atomic_load_explicit(&slot->Sequence, memory_order_relaxed);
+  } while ((before & 1) || before != after);
+
+  sample->Raw = (int16_t)(uint16_t)value;
+  sample->Status = (uint8_t)(value >> 16);
+  sample->Timestamp = ((uint64_t)high << 32) | low;
+  return 1;
+}
+
+/**
+  * @brief  Unmap a table mapped by TMP102_Shm_Attach or TMP102_Shm_Create.
+  * @Note 	Unmaps the length this process mapped, whatever the header says.
+  */
+void TMP102_Shm_Detach(TMP102_ShmMap *map)
+{
+  munmap((void *)map->Table, map->Length);
+  map->Table = 0;
+  map->Length = 0;
+  map->Devices = 0;
+}
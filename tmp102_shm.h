@@ -0,0 +1,97 @@
+/**
+  ******************************************************************************
+  * @file    tmp102_shm.h
+  * @author  Ngonidzashe Gwata
+  * @version V1.1.1
+  * @date    18-October-2026
+  * @brief   This file contains all the functions prototypes for the
+  *          shared memory latest-value table used on Linux hosts.
+  ******************************************************************************
+  *
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __TMP102_SHM_H
+#define __TMP102_SHM_H
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* Private define ------------------------------------------------------------*/
+#define TMP102_SHM_MAGIC		0x32303154	/*!< "T102" */
+#define TMP102_SHM_VERSION		2
+
+#define TMP102_SHM_OK			0	/*!< Raw holds a fresh reading */
+#define TMP102_SHM_NO_RESPONSE	1	/*!< Sensor did not answer, Raw is the last good value */
+#define TMP102_SHM_EMPTY		0xFF	/*!< Nothing published yet */
+
+/* Private typedef -----------------------------------------------------------*/
+/**
+  * @brief  One device, padded to a cache line so publishing one device never
+  *         disturbs readers of another. Only 32-bit atomics are used: they
+  *         are plain loads and stores on every target, where a 64-bit
+  *         atomic load can be a locked cmpxchg8b that faults on the
+  *         read-only mapping of a 32-bit reader.
+  */
+typedef struct
+{
+  atomic_uint_least32_t Sequence;	/*!< Odd while the writer is updating the slot */
+  atomic_uint_least32_t Value;		/*!< Raw (1/16 C) in bits 0-15, status in bits 16-23 */
+  atomic_uint_least32_t TimeLow;	/*!< Set by the publisher, ns, bits 0-31 */
+  atomic_uint_least32_t TimeHigh;	/*!< bits 32-63 */
+  uint8_t Reserved[48];
+} TMP102_ShmSlot;
+
+typedef struct
+{
+  uint32_t Magic;
+  uint32_t Version;
+  uint32_t Devices;
+  uint32_t Size;			/*!< Bytes of the object, header included */
+  uint8_t Reserved[48];
+  TMP102_ShmSlot Slot[1];	/*!< Devices slots */
+} TMP102_ShmTable;
+
+/**
+  * @brief  This process' mapping of a table. Length and Devices are what
+  *         this process mapped, never re-read from the shared header.
+  */
+typedef struct
+{
+  TMP102_ShmTable *Table;	/*!< Read only when returned by TMP102_Shm_Attach */
+  size_t Length;			/*!< Bytes mapped */
+  uint32_t Devices;			/*!< Slots inside the mapping */
+} TMP102_ShmMap;
+
+/**
+  * @brief  Consistent copy of one slot.
+  */
+typedef struct
+{
+  int16_t Raw;
+  uint8_t Status;
+  uint64_t Timestamp;
+} TMP102_ShmSample;
+
+/* Private macro -------------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+	// Publisher: create the named table, or reuse one of the same size; every slot TMP102_SHM_EMPTY
+	int TMP102_Shm_Create(const char *name, uint32_t devices, TMP102_ShmMap *map);
+
+	// Publisher: store the latest reading of a device
+	void TMP102_Shm_Publish(const TMP102_ShmMap *map, uint32_t device,
+	                        int16_t raw, uint8_t status, uint64_t timestamp);
+
+	// Consumer: map an existing table read only
+	int TMP102_Shm_Attach(const char *name, TMP102_ShmMap *map);
+
+	// Consumer: lock free snapshot of one device, returns 0 if device is out of range
+	int TMP102_Shm_Read(const TMP102_ShmMap *map, uint32_t device, TMP102_ShmSample *sample);
+
+	void TMP102_Shm_Detach(TMP102_ShmMap *map);
+
+#endif /* __TMP102_SHM_H */
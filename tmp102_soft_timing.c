@@ -0,0 +1,110 @@
+/**
+  ******************************************************************************
+  * @file    tmp102_soft_timing.c
+  * @author  Ngonidzashe Gwata
+  * @version V1.1.1
+  * @date    18-October-2026
+  * @brief   This file provides the bit timing model of the software I2C
+  *          master in tmp102_bus_soft.c: the cycles spent in each SCL phase
+  *          are the fixed overhead of the phase plus a number of delay loop
+  *          iterations. The START and STOP setup and hold phases run other
+  *          instructions around their delay than SCL high does, so they have
+  *          an overhead of their own. Every phase is rounded up, never down, so the bit
+  *          rate is the fastest the model can prove compliant, possibly below
+  *          the target when the fixed overheads alone exceed the spec period.
+  *          It needs only stdint.h; tools/tmp102_softcheck.c checks it on a
+  *          host against the standard and fast mode minimums.
+  *
+  *          Calibrating the cycle costs for a toolchain:
+  *            1. Build with TMP102_BUS_SOFT and the options of the release.
+  *            2. At a known core clock, force Low = High = Setup = 0 with
+  *               TMP102_Soft_SetTiming, run TMP102_GetStatus in a loop and
+  *               measure on a scope tLOW and tHIGH of the address bits, and
+  *               tSU;STA, tHD;STA and tSU;STO of the START and STOP. Keep
+  *               the shortest of those three as tSETUP.
+  *            3. Repeat with Low = High = Setup = 100.
+  *            4. tools/tmp102_softcheck -cal <clock> <tLOW0> <tHIGH0>
+  *               <tSETUP0> <tLOW100> <tHIGH100> <tSETUP100> turns the six
+  *               times (ns) into the TMP102_SOFT_xx values to build with.
+  ******************************************************************************
+ */
+
+#include "tmp102_soft_timing.h"
+
+/**
+  * @brief  I2C timing minimums in ns: tLOW, tHIGH, and the longest of
+  *         tSU;STA, tHD;STA and tSU;STO. tBUF equals tLOW in both modes.
+  */
+static const uint16_t SpecStandard[3] = {4700, 4000, 4700};	/* 100 kHz */
+static const uint16_t SpecFast[3] = {1300, 600, 600};			/* 400 kHz */
+
+/* Core cycles needed to cover ns at CoreClock, rounded up, exact in 32 bits */
+static uint32_t Soft_Cycles(uint32_t ns, uint32_t CoreClock)
+{
+  uint32_t whole = ns * (CoreClock / 1000);	// millionths of a cycle
+  uint32_t part = (whole % 1000000UL) * 1000 + ns * (CoreClock % 1000);	// billionths
+
+  return whole / 1000000UL + (part + 999999999UL) / 1000000000UL;
+}
+
+/* Delay loop count covering cycles once overhead is paid, rounded up */
+static uint16_t Soft_Loops(uint32_t cycles, uint16_t overhead)
+{
+  if (cycles <= overhead)
+  {
+    return 0;
+  }
+  return (uint16_t)((cycles - overhead + TMP102_SOFT_LOOP_CYCLES - 1) / TMP102_SOFT_LOOP_CYCLES);
+}
+
+/**
+  * @brief  Compute delay loop counts meeting the I2C spec at BitRate.
+  * @param  CoreClock: core clock in Hz, CLK_GetClockFreq() on target.
+  * @param  BitRate: target SCL frequency in Hz, up to 400000.
+  * @param  Timing: receives the loop counts and the cycles the model predicts.
+  * @retval 0 if BitRate is 0 or above fast mode, 1 otherwise.
+  * @Note 	The SCL period is at least CoreClock/BitRate cycles; slack over the
+  *         tLOW and tHIGH minimums is shared between both halves. SCL low is
+  *         sized against the high half's share, then SCL high against what
+  *         low came to, so neither half is a loop longer than it needs to be.
+  */
+uint8_t TMP102_Soft_ComputeTiming(uint32_t CoreClock, uint32_t BitRate,
+                                  TMP102_SoftTiming *Timing)
+{
+  const uint16_t *spec;
+  uint32_t period, low, high, share;
+
+  if (BitRate == 0 || BitRate > 400000)
+  {
+    return 0;
+  }
+  spec = (BitRate > 100000) ? SpecFast : SpecStandard;
+
+  period = (CoreClock + BitRate - 1) / BitRate;
+  low = Soft_Cycles(spec[0], CoreClock);
+  high = Soft_Cycles(spec[1], CoreClock);
+
+  // The high half's share of the period, as whole loops
+  share = high;
+  if (low + high < period)
+  {
+    share += (period - low - high) / 2;
+  }
+  share = TMP102_SOFT_HIGH_OVERHEAD + Soft_Loops(share, TMP102_SOFT_HIGH_OVERHEAD) * TMP102_SOFT_LOOP_CYCLES;
+
+  if (low + share < period)
+  {
+    low = period - share;
+  }
+  Timing->Low = Soft_Loops(low, TMP102_SOFT_LOW_OVERHEAD);
+  Timing->LowCycles = TMP102_SOFT_LOW_OVERHEAD + Timing->Low * TMP102_SOFT_LOOP_CYCLES;
+  if (Timing->LowCycles + high < period)
+  {
+    high = period - Timing->LowCycles;
+  }
+  Timing->High = Soft_Loops(high, TMP102_SOFT_HIGH_OVERHEAD);
+  Timing->Setup = Soft_Loops(Soft_Cycles(spec[2], CoreClock), TMP102_SOFT_SETUP_OVERHEAD);
+  Timing->HighCycles = TMP102_SOFT_HIGH_OVERHEAD + Timing->High * TMP102_SOFT_LOOP_CYCLES;
+  Timing->SetupCycles = TMP102_SOFT_SETUP_OVERHEAD + Timing->Setup * TMP102_SOFT_LOOP_CYCLES;
+  return 1;
+}
@@ -0,0 +1,64 @@
+/**
+  ******************************************************************************
+  * @file    tmp102_soft_timing.h
+  * @author  Ngonidzashe Gwata
+  * @version V1.1.1
+  * @date    18-October-2026
+  * @brief   This file contains the timing model of the software I2C master,
+  *          kept free of SPL types so it builds on a host.
+  ******************************************************************************
+  *
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __TMP102_SOFT_TIMING_H
+#define __TMP102_SOFT_TIMING_H
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Private typedef -----------------------------------------------------------*/
+/**
+  * @brief  Bit timing of the software master. Low, High and Setup are delay
+  *         loop counts; the Cycles fields are the core cycles the timing model
+  *         predicts for each phase, overhead included.
+  */
+typedef struct
+{
+  uint16_t Low;			/*!< SCL low, also used for tBUF */
+  uint16_t High;		/*!< SCL high */
+  uint16_t Setup;		/*!< tSU;STA, tHD;STA and tSU;STO */
+  uint16_t LowCycles;
+  uint16_t HighCycles;
+  uint16_t SetupCycles;
+} TMP102_SoftTiming;
+
+/* Private define ------------------------------------------------------------*/
+/**
+  * @brief  Cycle costs of the software master. The defaults are estimates
+  *         from the STM8 instruction sequence of each phase, not
+  *         measurements: calibrate them for each compiler and option set as
+  *         described in tmp102_soft_timing.c and override them with -D.
+  */
+#ifndef TMP102_SOFT_LOOP_CYCLES
+#define TMP102_SOFT_LOOP_CYCLES		8	/*!< One iteration of the delay loop */
+#endif
+#ifndef TMP102_SOFT_LOW_OVERHEAD
+#define TMP102_SOFT_LOW_OVERHEAD	40	/*!< SCL low cycles spent outside the delay loop */
+#endif
+#ifndef TMP102_SOFT_HIGH_OVERHEAD
+#define TMP102_SOFT_HIGH_OVERHEAD	30	/*!< SCL high cycles spent outside the delay loop */
+#endif
+#ifndef TMP102_SOFT_SETUP_OVERHEAD
+#define TMP102_SOFT_SETUP_OVERHEAD	20	/*!< Least cycles of tSU;STA, tHD;STA and tSU;STO spent outside the delay loop */
+#endif
+
+/* Private macro -------------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+	// Timing meeting the I2C spec at BitRate for a CoreClock (Hz) core, returns 0 if BitRate is out of range
+	uint8_t TMP102_Soft_ComputeTiming(uint32_t CoreClock, uint32_t BitRate,
+	                                  TMP102_SoftTiming *Timing);
+
+#endif /* __TMP102_SOFT_TIMING_H */
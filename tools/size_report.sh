@@ -0,0 +1,73 @@
+#!/bin/sh
+#
+# size_report.sh - per function flash/RAM usage of the TMP102 driver
+#
+# Usage: tools/size_report.sh [-b budget in bytes] <object>...
+#
+# The budgeted driver is the objects of tmp102_i2c.c, tmp102_codec.c and the
+# bus backend linked in: tmp102_bus_hw.o, or tmp102_bus_soft.o with
+# tmp102_soft_timing.o. Add tmp102_capture.o, tmp102_arbiter.o,
+# tmp102_rate.o or tmp102_cal.o when the firmware uses them.
+# Lists every symbol of each object as text (code and constants), data or bss
+# and fails when text + data summed over all of them, the flash footprint,
+# goes past the budget. A linked image is refused: it also holds the
+# application and the SPL, which the budget does not cover.
+# The budget defaults to TMP102_FLASH_BUDGET or 2048 bytes, the lean
+# (-DTMP102_NO_FLOAT) profile target for 8-16 KB STM8L parts.
+# Set NM to the toolchain's nm, e.g. NM=stm8-nm.
+#
+
+BUDGET="${TMP102_FLASH_BUDGET:-2048}"
+NM="${NM:-nm}"
+
+if [ "$1" = "-b" ]; then
+  BUDGET="$2"
+  shift 2
+fi
+
+if [ $# -eq 0 ]; then
+  echo "usage: $0 [-b budget in bytes] <object>..." >&2
+  exit 2
+fi
+
+for OBJ in "$@"; do
+  if [ ! -f "$OBJ" ]; then
+    echo "$0: $OBJ: no such object" >&2
+    exit 2
+  fi
+  # ELF e_type, read in the byte order EI_DATA gives: 1 is a relocatable object
+  if [ "$(od -An -tx1 -N4 "$OBJ" | tr -d ' ')" = "7f454c46" ]; then
+    if [ "$(od -An -tu1 -j5 -N1 "$OBJ" | tr -d ' ')" = "2" ]; then
+      ETYPE=$(od -An -tu1 -j17 -N1 "$OBJ" | tr -d ' ')
+    else
+      ETYPE=$(od -An -tu1 -j16 -N1 "$OBJ" | tr -d ' ')
+    fi
+    if [ "$ETYPE" != "1" ]; then
+      echo "$0: $OBJ: linked image, pass the driver's objects instead" >&2
+      exit 2
+    fi
+  fi
+done
+
+for OBJ in "$@"; do
+  "$NM" --size-sort -S -t d "$OBJ" | sed "s|^|$(basename "$OBJ") |"
+done | awk -v budget="$BUDGET" '
+NF >= 5 {
+  size = $3 + 0
+  type = toupper($4)
+  if (type == "T" || type == "R")      sec = "text"
+  else if (type == "D" || type == "G") sec = "data"
+  else if (type == "B" || type == "S" || type == "C") sec = "bss"
+  else next
+  total[sec] += size
+  printf "%-5s %6d  %-24s %s\n", sec, size, $1, $5
+}
+END {
+  flash = total["text"] + total["data"]
+  printf "\ntext %d  data %d  bss %d  flash %d / %d\n",
+         total["text"], total["data"], total["bss"], flash, budget
+  if (flash > budget) {
+    printf "FAIL: driver is %d bytes over its flash budget\n", flash - budget
+    exit 1
+  }
+}'
@@ -0,0 +1,469 @@
+/**
+  ******************************************************************************
+  * @file    tmp102_asyncbench.cpp
+  * @author  Ngonidzashe Gwata
+  * @version V1.1.1
+  * @date    18-October-2026
+  * @brief   Host tool that compares gateway code written as C++20 coroutines
+  *          over tmp102_async.hpp, one coroutine per sensor and every sensor
+  *          driven from one thread, with thread-per-bus blocking polling,
+  *          both on the simulated buses of tmp102_bus_sim.c.
+  *
+  *          Build:  cc -O2 -I. -Ihost -DTMP102_BUS_SIM -c tmp102_async.c
+  *                     tmp102_bus_sim.c tmp102_i2c.c tmp102_codec.c
+  *                  c++ -std=c++20 -O2 -I. -Ihost -DTMP102_BUS_SIM
+  *                     tools/tmp102_asyncbench.cpp tmp102_async.o tmp102_bus_sim.o
+  *                     tmp102_i2c.o tmp102_codec.o -pthread -o tmp102_asyncbench
+  *                  add -DTMP102_USE_ARBITER to both and tmp102_arbiter.c to the
+  *                  first for an arbiter build
+  *          Usage:  tmp102_asyncbench [buses] [sensors per bus] [rounds] [bit rate]
+  *
+  *          Defaults are 64 buses of 4 sensors at 400 kHz, 5 rounds. Each
+  *          round reads every sensor once, first as a temperature register
+  *          read, then as a one-shot conversion (26 ms) with OS polled until
+  *          it completes. The blocking side gives each bus a thread that runs
+  *          the same units one sensor after another and sleeps through every
+  *          transfer, as code built on readTempC and oneShot does. The
+  *          coroutine side starts one coroutine per sensor that co_awaits its
+  *          readings round after round, and a tmp102::Executor polls the
+  *          adapters and sleeps until the next transfer ends. Reported are
+  *          wall and CPU time, threads, and the memory each sensor costs while
+  *          it waits: its tmp102::Sensor, coroutine frame and Task, or its
+  *          share of a thread's stack.
+  *          Every reading is checked against the simulated sensor. The driver
+  *          path is checked too: readTempRaw over the simulated bus, and
+  *          one-shot coroutines over TMP102_Async_DriverBegin/Check, which
+  *          run on the arbiter when built with it. Exits 1 on any wrong
+  *          reading.
+  ******************************************************************************
+ */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include "tmp102_async.hpp"
+
+extern "C"
+{
+#include "tmp102_bus_sim.h"
+}
+
+#include <memory>
+#include <new>
+#include <vector>
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/resource.h>
+#ifdef __linux__
+#include <sys/prctl.h>
+#endif
+
+#define BASE	400		// 25 C, sensor k reads BASE + k + one-shots completed
+
+static uint16_t Buses;
+static uint8_t PerBus;
+static uint32_t Rounds, BitRate;
+static TMP102_SimBus *Sim;
+static TMP102_SimBus **SimList;
+static unsigned long *Good, *Bad;	// Per bus, threads never share a counter
+static bool OneShot;
+static size_t Allocated;			// Bytes from operator new, coroutine frames included
+
+// Out of line, so GCC does not pair inlined malloc/free against new/delete
+__attribute__((noinline)) void *operator new(size_t size)
+{
+  void *p = malloc(size ? size : 1);
+
+  if (!p)
+  {
+    throw std::bad_alloc();
+  }
+  Allocated += size;
+  return p;
+}
+
+__attribute__((noinline)) void operator delete(void *p) noexcept
+{
+  free(p);
+}
+
+__attribute__((noinline)) void operator delete(void *p, size_t) noexcept
+{
+  free(p);
+}
+
+static double Cpu(void)
+{
+  struct rusage ru;
+
+  getrusage(RUSAGE_SELF, &ru);
+  return (ru.ru_utime.tv_sec + ru.ru_stime.tv_sec) * 1e3 +
+         (ru.ru_utime.tv_usec + ru.ru_stime.tv_usec) / 1e3;
+}
+
+static void Check(uint16_t bus, uint8_t address, bool ok, int16_t raw, uint32_t conversions)
+{
+  if (ok && raw == BASE + ((address - 0x90) >> 1) + (int32_t)conversions)
+  {
+    Good[bus]++;
+  }
+  else
+  {
+    Bad[bus]++;
+  }
+}
+
+/* Fresh buses, every sensor in shutdown when one-shots are measured */
+static void Setup(void)
+{
+  uint16_t b;
+  uint8_t k;
+
+  for (b = 0; b < Buses; b++)
+  {
+    TMP102_Sim_Init(&Sim[b], PerBus, BitRate, BASE);
+    for (k = 0; k < PerBus; k++)
+    {
+      Sim[b].Sensor[k].Reg[CONFIG_REGISTER] |= OneShot ? 0x0100 : 0;
+    }
+    Good[b] = Bad[b] = 0;
+  }
+}
+
+static void Report(const char *label, double wall, double cpu, unsigned threads, double bytes)
+{
+  unsigned long good = 0, bad = 0;
+  uint16_t b;
+
+  for (b = 0; b < Buses; b++)
+  {
+    good += Good[b];
+    bad += Bad[b];
+  }
+  printf("  %-20s %9.1f %10.0f %8.1f %7u %12.0f %s\n", label, wall / 1e6,
+         good / (wall / 1e9), cpu, threads, bytes, bad ? "WRONG READINGS" : "ok");
+}
+
+/* ---- coroutines: one thread, every sensor in flight ---------------------- */
+
+/* What a gateway would write: one coroutine per sensor, its rounds in turn */
+static tmp102::Task Watch(tmp102::Sensor &dev, uint16_t bus)
+{
+  std::optional<int16_t> raw;
+  uint32_t round;
+
+  for (round = 0; round < Rounds; round++)
+  {
+    // if/else, not ?: - GCC 12 runs both co_awaits of a conditional
+    if (OneShot)
+    {
+      raw = co_await dev.OneShot();
+    }
+    else
+    {
+      raw = co_await dev.ReadTemp();
+    }
+    Check(bus, dev.Address(), raw.has_value(), raw.value_or(0), OneShot ? round + 1 : 0);
+  }
+}
+
+static void Sim_Idle(void *context)
+{
+  (void)context;
+  TMP102_Sim_Wait(SimList, Buses);
+}
+
+/* Start a coroutine per sensor and run them to the end, returns frame bytes per sensor */
+static double Watch_All(std::vector<std::unique_ptr<tmp102::Sensor>> &sensor,
+                        const std::vector<uint16_t> &busOf, tmp102::Executor &executor)
+{
+  std::vector<tmp102::Task> task;
+  size_t before;
+  uint32_t i;
+
+  task.reserve(sensor.size());
+  before = Allocated;
+  for (i = 0; i < sensor.size(); i++)
+  {
+    task.push_back(Watch(*sensor[i], busOf[i]));
+  }
+  before = Allocated - before;
+  executor.Run();
+  for (i = 0; i < task.size(); i++)
+  {
+    // A coroutine left suspended never got its readings
+    Bad[busOf[i]] += !task[i].Done();
+  }
+  return (double)before / (sensor.empty() ? 1 : sensor.size());
+}
+
+static int Async_Bench(void)
+{
+  uint32_t n = (uint32_t)Buses * PerBus, i;
+  std::vector<TMP102_AsyncBus> bus(Buses);
+  std::vector<TMP102_AsyncBus *> adapter(Buses);
+  std::vector<std::unique_ptr<tmp102::Sensor>> sensor;
+  std::vector<uint16_t> busOf(n);
+  tmp102::Executor executor(adapter.data(), Buses, Sim_Idle);
+  double wall, cpu, frame;
+  uint16_t b;
+
+  Setup();
+  for (b = 0; b < Buses; b++)
+  {
+    TMP102_Async_InitBus(&bus[b], TMP102_Sim_Begin, TMP102_Sim_Check, &Sim[b]);
+    adapter[b] = &bus[b];
+  }
+  sensor.reserve(n);
+  for (i = 0; i < n; i++)
+  {
+    busOf[i] = (uint16_t)(i / PerBus);
+    sensor.push_back(std::make_unique<tmp102::Sensor>(bus[busOf[i]], (uint8_t)(0x90 + 2 * (i % PerBus))));
+  }
+
+  wall = (double)TMP102_Sim_Now();
+  cpu = Cpu();
+  frame = Watch_All(sensor, busOf, executor);
+  Report(OneShot ? "coroutine one-shot" : "coroutine read", (double)TMP102_Sim_Now() - wall,
+         Cpu() - cpu, 1, sizeof(tmp102::Sensor) + frame + sizeof(tmp102::Task) +
+         (double)sizeof(TMP102_AsyncBus) / PerBus);
+  return 1;
+}
+
+/* ---- blocking: a thread per bus, one sensor at a time ---------------------- */
+
+/* The units tmp102_i2c.c runs, each ending with the pointer on TEMP */
+static ErrorStatus Blocking_ReadTemp(TMP102_SimBus *bus, uint8_t address, int16_t *raw)
+{
+  TMP102_BusStep step;
+  uint8_t rx[2];
+  uint16_t value;
+
+  TMP102_SetStep(&step, address | TMP102_BUS_READ, rx, 2);
+  if (TMP102_Sim_Transfer(bus, &step, 1) != SUCCESS)
+  {
+    return ERROR;
+  }
+  value = (uint16_t)((rx[0] << 8) | rx[1]);
+  *raw = TMP102_RegToCounts(value, (bool)(value & 0x01));
+  return SUCCESS;
+}
+
+static ErrorStatus Blocking_ReadConfig(TMP102_SimBus *bus, uint8_t address, uint16_t *value)
+{
+  TMP102_BusStep steps[3];
+  uint8_t pointer[2] = {CONFIG_REGISTER, TEMPERATURE_REGISTER};
+  uint8_t rx[2];
+
+  TMP102_SetStep(&steps[0], address, &pointer[0], 1);
+  TMP102_SetStep(&steps[1], address | TMP102_BUS_READ, rx, 2);
+  TMP102_SetStep(&steps[2], address, &pointer[1], 1);
+  if (TMP102_Sim_Transfer(bus, steps, 3) != SUCCESS)
+  {
+    return ERROR;
+  }
+  *value = (uint16_t)((rx[0] << 8) | rx[1]);
+  return SUCCESS;
+}
+
+static ErrorStatus Blocking_OneShot(TMP102_SimBus *bus, uint8_t address, int16_t *raw)
+{
+  TMP102_BusStep steps[2];
+  uint8_t tx[4];
+  uint16_t value, polls = TMP102_ASYNC_OS_POLLS;
+
+  if (Blocking_ReadConfig(bus, address, &value) != SUCCESS)
+  {
+    return ERROR;
+  }
+  tx[0] = CONFIG_REGISTER;
+  tx[1] = (uint8_t)((value | 0x8000) >> 8);
+  tx[2] = (uint8_t)value;
+  tx[3] = TEMPERATURE_REGISTER;
+  TMP102_SetStep(&steps[0], address, tx, 3);
+  TMP102_SetStep(&steps[1], address, &tx[3], 1);
+  if (TMP102_Sim_Transfer(bus, steps, 2) != SUCCESS)
+  {
+    return ERROR;
+  }
+  do
+  {
+    if (Blocking_ReadConfig(bus, address, &value) != SUCCESS || --polls == 0)
+    {
+      return ERROR;
+    }
+  } while ((value & 0x8000) == 0);
+  return Blocking_ReadTemp(bus, address, raw);
+}
+
+static void *Blocking_Run(void *arg)
+{
+  uint16_t b = (uint16_t)(size_t)arg;
+  uint8_t k, address;
+  uint32_t round;
+  ErrorStatus status;
+  int16_t raw = 0;
+
+  for (round = 0; round < Rounds; round++)
+  {
+    for (k = 0; k < PerBus; k++)
+    {
+      address = (uint8_t)(0x90 + 2 * k);
+      status = OneShot ? Blocking_OneShot(&Sim[b], address, &raw) :
+                         Blocking_ReadTemp(&Sim[b], address, &raw);
+      Check(b, address, status == SUCCESS, raw, OneShot ? round + 1 : 0);
+    }
+  }
+  return 0;
+}
+
+static int Blocking_Bench(void)
+{
+  pthread_t *thread = static_cast<pthread_t *>(calloc(Buses, sizeof *thread));
+  pthread_attr_t attr;
+  size_t stack = 0;
+  double wall, cpu;
+  uint16_t b;
+
+  if (!thread)
+  {
+    return 0;
+  }
+  pthread_attr_init(&attr);
+  pthread_attr_getstacksize(&attr, &stack);
+  pthread_attr_destroy(&attr);
+  Setup();
+
+  wall = (double)TMP102_Sim_Now();
+  cpu = Cpu();
+  for (b = 0; b < Buses; b++)
+  {
+    if (pthread_create(&thread[b], 0, Blocking_Run, (void *)(size_t)b) != 0)
+    {
+      fprintf(stderr, "could not start thread %u\n", b);
+      exit(2);
+    }
+  }
+  for (b = 0; b < Buses; b++)
+  {
+    pthread_join(thread[b], 0);
+  }
+  Report(OneShot ? "thread/bus one-shot" : "thread/bus read", (double)TMP102_Sim_Now() - wall,
+         Cpu() - cpu, Buses, (double)stack / PerBus);
+  free(thread);
+  return 1;
+}
+
+/* ---- driver path: readTempRaw and the driver adapter ----------------------- */
+
+#ifdef TMP102_BUS_SIM
+static int Driver_Check(void)
+{
+  TMP102_AsyncBus bus, *adapter = &bus;
+  TMP102_Transaction txn;
+  TMP102_SimBus *sim = &Sim[0];
+  std::vector<std::unique_ptr<tmp102::Sensor>> sensor;
+  std::vector<uint16_t> busOf(PerBus, 0);
+  // The driver path runs each unit inside Poll, there is nothing to sleep on
+  tmp102::Executor executor(&adapter, 1);
+  unsigned long bad;
+  uint8_t k;
+
+  OneShot = FALSE;
+  Setup();
+  TMP102_Sim_Attach(sim);
+#ifdef TMP102_USE_ARBITER
+  TMP102_Arbiter_Init(0);
+#endif
+  for (k = 0; k < PerBus; k++)
+  {
+    TMP102_SelectDevice((uint8_t)(0x90 + 2 * k));
+    Check(0, (uint8_t)(0x90 + 2 * k), TRUE, readTempRaw(), 0);
+    tmp102_sleep();
+  }
+
+  OneShot = TRUE;
+  TMP102_Async_InitBus(&bus, TMP102_Async_DriverBegin, TMP102_Async_DriverCheck, &txn);
+  for (k = 0; k < PerBus; k++)
+  {
+    sensor.push_back(std::make_unique<tmp102::Sensor>(bus, (uint8_t)(0x90 + 2 * k)));
+  }
+  Watch_All(sensor, busOf, executor);
+  bad = Bad[0];
+  printf("  driver path          %lu readings through readTempRaw and coroutines on the driver adapter %s\n",
+         Good[0], bad ? "WRONG READINGS" : "ok");
+  TMP102_Sim_Attach(0);
+  return bad == 0;
+}
+#endif
+
+static unsigned long Failures(void)
+{
+  unsigned long bad = 0;
+  uint16_t b;
+
+  for (b = 0; b < Buses; b++)
+  {
+    bad += Bad[b];
+  }
+  return bad;
+}
+
+int main(int argc, char **argv)
+{
+  unsigned long failed = 0;
+  uint16_t b;
+  int mode;
+
+  Buses = (uint16_t)((argc > 1) ? atoi(argv[1]) : 64);
+  PerBus = (uint8_t)((argc > 2) ? atoi(argv[2]) : 4);
+  Rounds = (uint32_t)((argc > 3) ? atol(argv[3]) : 5);
+  BitRate = (uint32_t)((argc > 4) ? atol(argv[4]) : 400000);
+  if (Buses == 0 || PerBus == 0 || PerBus > TMP102_SIM_MAX_SENSORS || Rounds == 0 || BitRate == 0)
+  {
+    fprintf(stderr, "usage: %s [buses] [sensors per bus, 1-%d] [rounds] [bit rate]\n",
+            argv[0], TMP102_SIM_MAX_SENSORS);
+    return 2;
+  }
+#ifdef __linux__
+  // Sleep to the wire time, not to the default 50 us timer slack
+  prctl(PR_SET_TIMERSLACK, 1UL, 0, 0, 0);
+#endif
+  Sim = static_cast<TMP102_SimBus *>(calloc(Buses, sizeof *Sim));
+  SimList = static_cast<TMP102_SimBus **>(calloc(Buses, sizeof *SimList));
+  Good = static_cast<unsigned long *>(calloc(Buses, sizeof *Good));
+  Bad = static_cast<unsigned long *>(calloc(Buses, sizeof *Bad));
+  if (!Sim || !SimList || !Good || !Bad)
+  {
+    return 2;
+  }
+  for (b = 0; b < Buses; b++)
+  {
+    SimList[b] = &Sim[b];
+  }
+
+  printf("%u sensors on %u buses at %lu Hz, %lu rounds\n", (unsigned)Buses * PerBus,
+         (unsigned)Buses, (unsigned long)BitRate, (unsigned long)Rounds);
+  printf("                         wall ms  readings/s   cpu ms threads bytes/sensor\n");
+  for (mode = 0; mode < 2; mode++)
+  {
+    OneShot = mode ? TRUE : FALSE;
+    if (!Async_Bench())
+    {
+      return 2;
+    }
+    failed += Failures();
+    if (!Blocking_Bench())
+    {
+      return 2;
+    }
+    failed += Failures();
+  }
+#ifdef TMP102_BUS_SIM
+  failed += !Driver_Check();
+#endif
+  return failed ? 1 : 0;
+}
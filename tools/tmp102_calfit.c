@@ -0,0 +1,223 @@
+/**
+  ******************************************************************************
+  * @file    tmp102_calfit.c
+  * @author  Ngonidzashe Gwata
+  * @version V1.1.1
+  * @date    18-October-2026
+  * @brief   Host tool that fits a TMP102_Calibration from a reference probe
+  *          log and prints it as a C initializer.
+  *
+  *          Build:  cc -O2 -I. tools/tmp102_calfit.c tmp102_cal.c -lm -o tmp102_calfit
+  *          Usage:  tmp102_calfit [-s shift] [-n name] [log.csv]
+  *
+  *          The log has one "raw,reference" line per sample: raw is the
+  *          readTempRaw value of the sensor (1/16 C counts) and reference the
+  *          probe temperature in C. Lines that do not parse, such as a header,
+  *          are skipped. Breakpoints are 2^shift counts apart (default 7, 8 C)
+  *          and cover the logged range. The table is a least squares fit of
+  *          the error with linear interpolation between breakpoints; segments
+  *          without samples follow a straight line fitted over the whole log.
+  *          The normal equations are tridiagonal, so the fit is one pass over
+  *          the log plus O(points), whatever the log length.
+  *          The error before and after is computed with TMP102_Cal_Apply
+  *          itself, so it is what the firmware will achieve on this log.
+  ******************************************************************************
+ */
+
+#include "tmp102_cal.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_POINTS	64
+#define ANCHOR		1.0	// Weight of the straight line, in samples, at every breakpoint
+
+typedef struct
+{
+  int16_t Raw;
+  double Error;	// reference - raw, in counts
+} Sample;
+
+static Sample *Samples;
+static size_t Count, Capacity;
+
+static int Load(FILE *in)
+{
+  char line[128];
+  long raw;
+  double reference;
+
+  while (fgets(line, sizeof line, in))
+  {
+    if (sscanf(line, "%ld ,%lf", &raw, &reference) != 2 || raw < -32768 || raw > 32767)
+    {
+      continue;
+    }
+    if (Count == Capacity)
+    {
+      Capacity = Capacity ? 2*Capacity : 4096;
+      Samples = realloc(Samples, Capacity*sizeof *Samples);
+      if (!Samples)
+      {
+        return 0;
+      }
+    }
+    Samples[Count].Raw = (int16_t)raw;
+    Samples[Count].Error = reference*16.0 - (double)raw;
+    Count++;
+  }
+  return 1;
+}
+
+static void Report(const char *label, const TMP102_Calibration *cal)
+{
+  double sum = 0, worst = 0, e;
+  size_t i;
+
+  for (i = 0; i < Count; i++)
+  {
+    e = Samples[i].Raw + Samples[i].Error - TMP102_Cal_Apply(cal, Samples[i].Raw);
+    sum += e*e;
+    if (fabs(e) > worst)
+    {
+      worst = fabs(e);
+    }
+  }
+  printf("/* %s: rms %.4f C, max %.4f C */\n", label, sqrt(sum/Count)/16.0, worst/16.0);
+}
+
+int main(int argc, char **argv)
+{
+  static double diag[MAX_POINTS], upper[MAX_POINTS], rhs[MAX_POINTS];
+  static int8_t table[MAX_POINTS];
+  const char *name = "TMP102_Cal";
+  FILE *in = stdin;
+  int shift = TMP102_CAL_MAX_SHIFT;
+  int16_t low = 32767, high = -32768;
+  double sx = 0, sy = 0, sxx = 0, sxy = 0, slope, intercept, t, w;
+  int8_t zero = 0;
+  TMP102_Calibration cal;
+  int points, clamped = 0, k, opt;
+  size_t i;
+  long position;
+
+  for (opt = 1; opt < argc; opt++)
+  {
+    if (!strcmp(argv[opt], "-s") && opt + 1 < argc)
+    {
+      shift = atoi(argv[++opt]);
+    }
+    else if (!strcmp(argv[opt], "-n") && opt + 1 < argc)
+    {
+      name = argv[++opt];
+    }
+    else if (!(in = fopen(argv[opt], "r")))
+    {
+      perror(argv[opt]);
+      return 1;
+    }
+  }
+  if (shift < 0 || shift > TMP102_CAL_MAX_SHIFT)
+  {
+    fprintf(stderr, "shift must be 0 to %d\n", TMP102_CAL_MAX_SHIFT);
+    return 1;
+  }
+  if (!Load(in) || Count < 2)
+  {
+    fprintf(stderr, "need at least two raw,reference samples\n");
+    return 1;
+  }
+
+  // Straight line through the whole log, anchors empty segments
+  for (i = 0; i < Count; i++)
+  {
+    sx += Samples[i].Raw;
+    sy += Samples[i].Error;
+    sxx += (double)Samples[i].Raw*Samples[i].Raw;
+    sxy += Samples[i].Raw*Samples[i].Error;
+    if (Samples[i].Raw < low) low = Samples[i].Raw;
+    if (Samples[i].Raw > high) high = Samples[i].Raw;
+  }
+  t = Count*sxx - sx*sx;
+  slope = (t > 0) ? (Count*sxy - sx*sy)/t : 0;
+  intercept = (sy - slope*sx)/Count;
+
+  cal.Shift = (uint8_t)shift;
+  cal.Base = (int16_t)(low & ~((1 << shift) - 1));
+  points = ((high - cal.Base + (1 << shift) - 1) >> shift) + 1;
+  if (points > MAX_POINTS)
+  {
+    fprintf(stderr, "%d breakpoints needed, raise the shift\n", points);
+    return 1;
+  }
+
+  for (k = 0; k < points; k++)
+  {
+    diag[k] = ANCHOR;
+    upper[k] = 0;
+    rhs[k] = ANCHOR*(intercept + slope*(cal.Base + (k << shift)));
+  }
+  // Every sample weighs on the two breakpoints around it, as in TMP102_Cal_Apply
+  for (i = 0; i < Count; i++)
+  {
+    position = Samples[i].Raw - cal.Base;
+    k = (int)(position >> shift);
+    if (k >= points - 1)
+    {
+      diag[points - 1] += 1;
+      rhs[points - 1] += Samples[i].Error;
+      continue;
+    }
+    w = (double)(position - ((long)k << shift))/(1 << shift);
+    diag[k] += (1 - w)*(1 - w);
+    diag[k + 1] += w*w;
+    upper[k] += (1 - w)*w;
+    rhs[k] += (1 - w)*Samples[i].Error;
+    rhs[k + 1] += w*Samples[i].Error;
+  }
+  // Tridiagonal solve, forward elimination then back substitution
+  for (k = 1; k < points; k++)
+  {
+    t = upper[k - 1]/diag[k - 1];
+    diag[k] -= t*upper[k - 1];
+    rhs[k] -= t*rhs[k - 1];
+  }
+  for (k = points - 1; k >= 0; k--)
+  {
+    if (k < points - 1)
+    {
+      rhs[k] -= upper[k]*rhs[k + 1];
+    }
+    rhs[k] /= diag[k];
+    t = floor(rhs[k] + 0.5);
+    if (t > 127 || t < -128)
+    {
+      t = (t > 0) ? 127 : -128;
+      clamped++;
+    }
+    table[k] = (int8_t)t;
+  }
+
+  cal.Points = 1;
+  cal.Table = &zero;
+  printf("/* %zu samples, %.2f C to %.2f C */\n", Count, low/16.0, high/16.0);
+  Report("uncorrected", &cal);
+  cal.Points = (uint8_t)points;
+  cal.Table = table;
+  Report("corrected", &cal);
+  if (clamped)
+  {
+    printf("/* %d breakpoints clamped to the int8 range */\n", clamped);
+  }
+
+  printf("static const int8_t %s_Table[%d] =\n{\n ", name, points);
+  for (k = 0; k < points; k++)
+  {
+    printf(" %d%s", table[k], (k < points - 1) ? "," : "\n");
+  }
+  printf("};\nconst TMP102_Calibration %s = { %d, %d, %d, %s_Table };\n",
+         name, cal.Base, cal.Shift, cal.Points, name);
+  return 0;
+}
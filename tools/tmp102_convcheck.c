@@ -0,0 +1,165 @@
+/**
+  ******************************************************************************
+  * @file    tmp102_convcheck.c
+  * @author  Ngonidzashe Gwata
+  * @version V1.1.1
+  * @date    18-October-2026
+  * @brief   Host tool that proves the conversions in tmp102_codec.c against
+  *          a reference model and times them.
+  *
+  *          Build:  cc -O2 -I. tools/tmp102_convcheck.c tmp102_codec.c -lm -o tmp102_convcheck
+  *          Usage:  tmp102_convcheck [passes]
+  *
+  *          Every 12-bit (4096) and 13-bit (8192) code goes through every
+  *          conversion entry point, each embedded in all register values that
+  *          carry it, so the ignored low bits are covered too. The reference
+  *          model is the original readTempC arithmetic: explicit two's
+  *          complement, then (|counts|*625 + 500)/1000 in 32 bits. C and F are
+  *          checked exactly against the counts in double precision.
+  *          Exits 1 if any entry point disagrees with the model, so a faster
+  *          kernel can be dropped into tmp102_codec.c and proven bit-exact
+  *          here before it goes into firmware. The timings are ns per
+  *          conversion on this host, averaged over every code, with the
+  *          reference model timed alongside for comparison.
+  ******************************************************************************
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include "tmp102_codec.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+// Keep the reference model out of line, like the codec it is timed against
+#ifdef __GNUC__
+#define NOINLINE	__attribute__((noinline))
+#else
+#define NOINLINE
+#endif
+
+static int Failures;
+volatile double Sink;	// Keeps the timed conversions from being optimised out
+
+static void Fail(const char *entry, unsigned input, long got, long wanted)
+{
+  if (Failures++ < 10)
+  {
+    printf("%s(0x%04X): got %ld, reference %ld\n", entry, input, got, wanted);
+  }
+}
+
+static NOINLINE int16_t RefCounts(uint16_t RegValue, uint8_t extended)
+{
+  int32_t code = RegValue >> (extended ? 3 : 4);
+  int32_t half = extended ? 0x1000 : 0x800;
+
+  return (int16_t)((code >= half) ? code - 2*half : code);
+}
+
+static NOINLINE int16_t RefTenths(int16_t counts)
+{
+  int32_t magnitude = (counts < 0) ? -(int32_t)counts : counts;
+
+  magnitude = (magnitude*625 + 500)/1000;
+  return (int16_t)((counts < 0) ? -magnitude : magnitude);
+}
+
+static double Now(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec*1e9 + ts.tv_nsec;
+}
+
+static void Check(void)
+{
+  uint32_t reg;
+  uint8_t ext;
+  int16_t counts, wanted;
+  int32_t code;
+
+  for (ext = 0; ext < 2; ext++)
+  {
+    for (reg = 0; reg < 0x10000; reg++)
+    {
+      counts = TMP102_RegToCounts((uint16_t)reg, ext);
+      wanted = RefCounts((uint16_t)reg, ext);
+      if (counts != wanted)
+      {
+        Fail(ext ? "RegToCounts13" : "RegToCounts12", reg, counts, wanted);
+      }
+    }
+    for (code = ext ? -4096 : -2048; code < (ext ? 4096 : 2048); code++)
+    {
+      reg = TMP102_CountsToReg((int16_t)code, ext);
+      if (reg & (ext ? 0x07 : 0x0F) || RefCounts((uint16_t)reg, ext) != code)
+      {
+        Fail(ext ? "CountsToReg13" : "CountsToReg12", (uint16_t)code, (long)reg, code);
+      }
+    }
+  }
+
+  // 13-bit codes include every 12-bit one
+  for (code = -4096; code < 4096; code++)
+  {
+    counts = (int16_t)code;
+    if (TMP102_CountsToTenths(counts) != RefTenths(counts))
+    {
+      Fail("CountsToTenths", (uint16_t)code, TMP102_CountsToTenths(counts), RefTenths(counts));
+    }
+#ifndef TMP102_NO_FLOAT
+    if (TMP102_CountsToC(counts) != code/16.0)
+    {
+      Fail("CountsToC", (uint16_t)code, lround(TMP102_CountsToC(counts)*16), code);
+    }
+    if (fabs(TMP102_CountsToF(counts) - (code*9/80.0 + 32)) > ldexp(1, ilogb(code*9/80.0 + 32) - 23))
+    {
+      Fail("CountsToF", (uint16_t)code, lround(TMP102_CountsToF(counts)*80), code*9 + 2560);
+    }
+#endif
+  }
+}
+
+#define TIME(label, expr)	do { \
+    double start = Now(), sum = 0; \
+    for (pass = 0; pass < passes; pass++) \
+      for (code = -4096; code < 4096; code++) \
+        sum += (expr); \
+    Sink = sum; \
+    printf("  %-22s %6.2f ns\n", label, (Now() - start)/(passes*8192.0)); \
+  } while (0)
+
+int main(int argc, char **argv)
+{
+  long passes = (argc > 1) ? atol(argv[1]) : 2000;
+  long pass;
+  int32_t code;
+
+  Check();
+  if (Failures)
+  {
+    printf("%d mismatches\n", Failures);
+    return 1;
+  }
+  printf("all codes match the reference model\n");
+  if (passes < 1)
+  {
+    return 0;
+  }
+
+  printf("ns per conversion, %ld passes over 8192 codes:\n", passes);
+  TIME("RefCounts", RefCounts((uint16_t)((uint32_t)code << 3), 1));
+  TIME("RegToCounts", TMP102_RegToCounts((uint16_t)((uint32_t)code << 3), 1));
+  TIME("CountsToReg", TMP102_CountsToReg((int16_t)code, 1));
+  TIME("RefTenths", RefTenths((int16_t)code));
+  TIME("CountsToTenths", TMP102_CountsToTenths((int16_t)code));
+#ifndef TMP102_NO_FLOAT
+  TIME("CountsToC", TMP102_CountsToC((int16_t)code));
+  TIME("CountsToF", TMP102_CountsToF((int16_t)code));
+#endif
+  return 0;
+}
@@ -0,0 +1,274 @@
+/**
+  ******************************************************************************
+  * @file    tmp102_fleetbench.c
+  * @author  Ngonidzashe Gwata
+  * @version V1.1.1
+  * @date    18-October-2026
+  * @brief   Host tool that measures how the fleet aggregator, tmp102_fleet.c,
+  *          scales with the number of devices and with cores, and checks
+  *          that no sample is lost or counted twice on the way.
+  *
+  *          Build:  cc -O2 -std=c11 -I. tools/tmp102_fleetbench.c tmp102_fleet.c
+  *                     -pthread -o tmp102_fleetbench
+  *          Usage:  tmp102_fleetbench [max devices] [max threads] [windows]
+  *
+  *          Device counts go from 1k up to max devices (default 1M) in steps
+  *          of ten and thread counts from 1 up to max threads (default the
+  *          online cores) in steps of two. Each thread owns an equal range of
+  *          devices, as a gateway would split its sensors, and per window adds
+  *          SAMPLES samples for each of its devices in shuffled order: most on
+  *          time for the newest window, some late for the oldest open one, a
+  *          few too late to count and a few failed reads. It then summarises and clears its range
+  *          of the oldest window, and the first thread retires it once every
+  *          range is done. Times start past 2^32 ms, as epoch milliseconds do.
+  *          Add is reported in million samples per second over all threads,
+  *          the window pass in ns per device. Every window's counts and the
+  *          Late counter are checked against what was generated; exits 1 on
+  *          any mismatch.
+  ******************************************************************************
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include "tmp102_fleet.h"
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+#define SAMPLES		4				// Samples per device per window
+#define WINDOW_MS	60000
+#define START_MS	1790000000000ULL	// Past 2^32 ms, epoch time in 2026
+
+typedef struct
+{
+  pthread_t Thread;
+  uint32_t First, Last;			// Devices owned
+  uint32_t N;					// Samples per window
+  uint32_t *Device;
+  uint64_t *Time;
+  int16_t *Raw;
+  uint32_t Oldest, Newest, TooLate;	// Generated per window, by target
+  uint32_t Invalid;				// Failed reads generated per window
+  uint64_t Late;
+  unsigned long Errors;
+} Worker;
+
+static TMP102_Fleet Fleet;
+static pthread_barrier_t Barrier;
+static Worker *Workers;
+static uint32_t Windows;
+static double AddNs, PassNs;
+static volatile long Sink;
+
+static double Now(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec*1e9 + ts.tv_nsec;
+}
+
+static uint32_t Random(uint32_t *state)
+{
+  *state ^= *state << 13;
+  *state ^= *state >> 17;
+  *state ^= *state << 5;
+  return *state;
+}
+
+/* One window of samples for the worker's range, relative to window 0 */
+static void Generate(Worker *w, uint32_t seed)
+{
+  uint32_t i, j, r, d;
+  uint64_t tmp64;
+  int16_t tmp16;
+  int window;
+
+  w->Oldest = w->Newest = w->TooLate = w->Invalid = 0;
+  for (i = 0; i < w->N; i++)
+  {
+    r = Random(&seed) % 100;
+    // 89% on time, 1% failed reads on time, 9% late but open, 1% too late
+    window = (r < 90) ? 1 : (r < 99) ? 0 : -1;
+    w->Oldest += (window == 0);
+    w->Newest += (r < 89);
+    w->Invalid += (r == 89);
+    w->TooLate += (window == -1);
+    w->Device[i] = w->First + i / SAMPLES;
+    w->Time[i] = (uint64_t)((int64_t)(START_MS / WINDOW_MS) + window) * WINDOW_MS +
+                 Random(&seed) % WINDOW_MS;
+    // 25 C give or take 8 C, so both thresholds see traffic
+    w->Raw[i] = (r == 89) ? TMP102_TEMP_INVALID : (int16_t)(400 + (int)(Random(&seed) % 257) - 128);
+  }
+  // Shuffle, samples arrive in no particular device or time order
+  for (i = w->N - 1; i > 0; i--)
+  {
+    j = Random(&seed) % (i + 1);
+    d = w->Device[i]; w->Device[i] = w->Device[j]; w->Device[j] = d;
+    tmp64 = w->Time[i]; w->Time[i] = w->Time[j]; w->Time[j] = tmp64;
+    tmp16 = w->Raw[i]; w->Raw[i] = w->Raw[j]; w->Raw[j] = tmp16;
+  }
+}
+
+static void *Run(void *arg)
+{
+  Worker *w = arg;
+  uint32_t n = w->Last - w->First, window, i, accepted, counted, expected;
+  TMP102_FleetWindow view;
+  int16_t *mean = malloc((size_t)n * sizeof *mean);
+  double start = 0;
+  long sink = 0;
+
+  for (window = 0; window < Windows; window++)
+  {
+    pthread_barrier_wait(&Barrier);
+    if (w == Workers)
+    {
+      start = Now();
+    }
+    accepted = TMP102_Fleet_AddBatch(&Fleet, w->Device, w->Time, w->Raw, w->N);
+    pthread_barrier_wait(&Barrier);
+    if (w == Workers)
+    {
+      AddNs += Now() - start;
+      start = Now();
+    }
+    TMP102_Fleet_Summarise(&Fleet, w->First, w->Last, &view, mean);
+    pthread_barrier_wait(&Barrier);
+    if (w == Workers)
+    {
+      PassNs += Now() - start;
+    }
+
+    // Untimed: the counts must account for every sample generated
+    counted = 0;
+    for (i = 0; i < n; i++)
+    {
+      counted += view.Count[i];
+      sink += mean[i];
+    }
+    expected = w->Oldest + (window ? w->Newest : 0);
+    w->Errors += (accepted != w->N - w->TooLate - w->Invalid) + (counted != expected) +
+                 (view.Window != START_MS / WINDOW_MS + window);
+    w->Late += w->TooLate;
+
+    pthread_barrier_wait(&Barrier);
+    if (w == Workers)
+    {
+      start = Now();
+    }
+    TMP102_Fleet_Clear(&Fleet, w->First, w->Last);
+    pthread_barrier_wait(&Barrier);
+    if (w == Workers)
+    {
+      PassNs += Now() - start;
+    }
+    if (w == Workers)
+    {
+      TMP102_Fleet_Retire(&Fleet);
+    }
+    // Same samples one window on for the next round
+    for (i = 0; i < w->N; i++)
+    {
+      w->Time[i] += WINDOW_MS;
+    }
+  }
+  Sink += sink;
+  free(mean);
+  return 0;
+}
+
+static int Bench(uint32_t devices, int threads)
+{
+  void *storage = malloc(TMP102_Fleet_StorageSize(devices, 2));
+  uint64_t late = 0;
+  unsigned long errors = 0;
+  int t;
+
+  if (!storage)
+  {
+    return -1;
+  }
+  TMP102_Fleet_Init(&Fleet, storage, devices, 2, WINDOW_MS, START_MS, 320, 480);
+  Workers = calloc((size_t)threads, sizeof *Workers);
+  AddNs = PassNs = 0;
+  pthread_barrier_init(&Barrier, 0, (unsigned)threads);
+  for (t = 0; t < threads; t++)
+  {
+    Worker *w = &Workers[t];
+
+    w->First = (uint32_t)((uint64_t)devices * t / threads);
+    w->Last = (uint32_t)((uint64_t)devices * (t + 1) / threads);
+    w->N = (w->Last - w->First) * SAMPLES;
+    w->Device = malloc((size_t)w->N * sizeof *w->Device);
+    w->Time = malloc((size_t)w->N * sizeof *w->Time);
+    w->Raw = malloc((size_t)w->N * sizeof *w->Raw);
+    if (!w->Device || !w->Time || !w->Raw)
+    {
+      return -1;
+    }
+    Generate(w, 2463534242u + (uint32_t)t);
+  }
+  for (t = 0; t < threads; t++)
+  {
+    pthread_create(&Workers[t].Thread, 0, Run, &Workers[t]);
+  }
+  for (t = 0; t < threads; t++)
+  {
+    pthread_join(Workers[t].Thread, 0);
+    late += Workers[t].Late;
+    errors += Workers[t].Errors;
+    free(Workers[t].Device);
+    free(Workers[t].Time);
+    free(Workers[t].Raw);
+  }
+  errors += (atomic_load(&Fleet.Late) != late);
+  pthread_barrier_destroy(&Barrier);
+
+  printf("  %8lu %7d %10.1f %10.2f %s\n", (unsigned long)devices, threads,
+         (double)devices * SAMPLES * Windows / AddNs * 1e3, PassNs / ((double)devices * Windows),
+         errors ? "MISMATCH" : "ok");
+  free(Workers);
+  free(storage);
+  return errors != 0;
+}
+
+int main(int argc, char **argv)
+{
+  long cores = sysconf(_SC_NPROCESSORS_ONLN);
+  uint32_t maxDevices = (argc > 1) ? (uint32_t)atol(argv[1]) : 1000000;
+  int maxThreads = (argc > 2) ? atoi(argv[2]) : (cores > 0 ? (int)cores : 1);
+  uint32_t devices;
+  int threads, r, failed = 0;
+
+  Windows = (argc > 3) ? (uint32_t)atol(argv[3]) : 8;
+  if (maxDevices < 1000 || maxThreads < 1 || Windows < 1)
+  {
+    fprintf(stderr, "usage: %s [max devices >= 1000] [max threads] [windows]\n", argv[0]);
+    return 2;
+  }
+
+  printf("%d samples per device per window, %lu windows\n", SAMPLES, (unsigned long)Windows);
+  printf("   devices threads   Msample/s  pass ns/dev\n");
+  for (devices = 1000; devices <= maxDevices; devices *= 10)
+  {
+    for (threads = 1; threads <= maxThreads; threads *= 2)
+    {
+      r = Bench(devices, threads);
+      if (r < 0)
+      {
+        fprintf(stderr, "out of memory at %lu devices\n", (unsigned long)devices);
+        return 2;
+      }
+      failed |= r;
+    }
+    if (devices > UINT32_MAX / 10)
+    {
+      break;
+    }
+  }
+  return failed;
+}
@@ -0,0 +1,201 @@
+/**
+  ******************************************************************************
+  * @file    tmp102_replay_run.c
+  * @author  Ngonidzashe Gwata
+  * @version V1.1.1
+  * @date    18-October-2026
+  * @brief   Host tool that plays a capture log back through the driver and
+  *          prints TMP102_ReplayStats.
+  *
+  *          Build:  cc -O2 -I. -Ihost -DTMP102_BUS_REPLAY tools/tmp102_replay_run.c
+  *                     tmp102_i2c.c tmp102_codec.c tmp102_replay.c -o tmp102_replay_run
+  *                  add -DTMP102_USE_ARBITER tmp102_arbiter.c for an arbiter build
+  *          Usage:  tmp102_replay_run [-r] [-l] log [operation ...]
+  *
+  *          The log is the TMP102_Capture_Length bytes of a capture buffer
+  *          dumped from the field unit. The operations are the driver calls
+  *          the unit made, in order:
+  *            select=<address>  TMP102_SelectDevice, address as 0x90
+  *            reset  temp  raw  low  high  alert  oneshot  status
+  *            sleep  wakeup  rate=<0-3>  setlow=<counts>  sethigh=<counts>
+  *          With none, temp is repeated until the log runs out, which fits a
+  *          unit that only polls. -l repeats the operations the same way and
+  *          -r sleeps out the recorded gaps between transfers.
+  *          Each operation's result is printed, then the statistics. Exits 1
+  *          if the driver's traffic differed from the log, went past its end
+  *          or left records unplayed. A log cut short by a full capture
+  *          buffer is reported as such, and the transfers it could not hold
+  *          are not counted as going past its end.
+  ******************************************************************************
+ */
+
+#include "tmp102_i2c.h"
+#include "tmp102_replay.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static int Run(const char *op)
+{
+  const char *arg = strchr(op, '=');
+  size_t length = arg ? (size_t)(arg - op) : strlen(op);
+  int16_t counts;
+  ErrorStatus status;
+
+#define IS(name)	(length == sizeof(name) - 1 && !strncmp(op, name, length))
+  arg = arg ? arg + 1 : "";
+  if (IS("select"))
+  {
+    TMP102_SelectDevice((uint8_t)strtoul(arg, 0, 0));
+    printf("%-10s 0x%02X\n", op, (unsigned)strtoul(arg, 0, 0));
+  }
+  else if (IS("reset"))
+  {
+    TMP102_reset();
+    printf("%s\n", op);
+  }
+  else if (IS("temp"))
+  {
+    printf("%-10s %d (0.1 C)\n", op, readTempC());
+  }
+  else if (IS("raw"))
+  {
+    status = readTempRawEx(&counts);
+    printf("%-10s %d (1/16 C)%s\n", op, counts, (status == SUCCESS) ? "" : " no answer");
+  }
+  else if (IS("low"))
+  {
+    printf("%-10s %d (1/16 C)\n", op, readLowTemp());
+  }
+  else if (IS("high"))
+  {
+    printf("%-10s %d (1/16 C)\n", op, readHighTemp());
+  }
+  else if (IS("alert"))
+  {
+    printf("%-10s %d\n", op, alert());
+  }
+  else if (IS("oneshot"))
+  {
+    printf("%-10s %u\n", op, oneShot(FALSE));
+  }
+  else if (IS("status"))
+  {
+    printf("%-10s %s\n", op, (TMP102_GetStatus() == SUCCESS) ? "present" : "no answer");
+  }
+  else if (IS("sleep"))
+  {
+    tmp102_sleep();
+    printf("%s\n", op);
+  }
+  else if (IS("wakeup"))
+  {
+    tmp102_wakeup();
+    printf("%s\n", op);
+  }
+  else if (IS("rate") && *arg)
+  {
+    setConversionRate((uint8_t)atoi(arg));
+    printf("%s\n", op);
+  }
+  else if (IS("setlow") && *arg)
+  {
+    setLowTemp((int16_t)atoi(arg));
+    printf("%s\n", op);
+  }
+  else if (IS("sethigh") && *arg)
+  {
+    setHighTemp((int16_t)atoi(arg));
+    printf("%s\n", op);
+  }
+  else
+  {
+    fprintf(stderr, "unknown operation %s\n", op);
+    return 0;
+  }
+#undef IS
+  return 1;
+}
+
+/* TRUE once the driver has consumed every record of the log */
+static bool Done(void)
+{
+  TMP102_ReplayStats stats;
+
+  TMP102_Replay_GetStats(&stats);
+  return (stats.Remaining == 0) ? TRUE : FALSE;
+}
+
+int main(int argc, char **argv)
+{
+  static const char *Poll[] = {"temp"};
+  TMP102_ReplayStats stats;
+  const char **ops;
+  bool realTime = FALSE, loop = FALSE;
+  uint32_t before;
+  int arg = 1, count, i;
+
+  for (; arg < argc && argv[arg][0] == '-'; arg++)
+  {
+    if (!strcmp(argv[arg], "-r"))
+    {
+      realTime = TRUE;
+    }
+    else if (!strcmp(argv[arg], "-l"))
+    {
+      loop = TRUE;
+    }
+    else
+    {
+      break;
+    }
+  }
+  if (arg >= argc)
+  {
+    fprintf(stderr, "usage: %s [-r] [-l] log [operation ...]\n", argv[0]);
+    return 2;
+  }
+  if (TMP102_Replay_Open(argv[arg], realTime) != SUCCESS)
+  {
+    fprintf(stderr, "%s: not a readable capture log\n", argv[arg]);
+    return 2;
+  }
+  ops = (const char **)&argv[arg + 1];
+  count = argc - arg - 1;
+  if (count == 0)
+  {
+    ops = Poll;
+    count = 1;
+    loop = TRUE;
+  }
+
+  do
+  {
+    TMP102_Replay_GetStats(&stats);
+    before = stats.Transfers;
+    for (i = 0; i < count && !(loop && Done()); i++)
+    {
+      if (!Run(ops[i]))
+      {
+        TMP102_Replay_Close();
+        return 2;
+      }
+    }
+    // Operations that never reach the bus would loop forever
+    TMP102_Replay_GetStats(&stats);
+  } while (loop && !Done() && stats.Transfers != before);
+
+  TMP102_Replay_GetStats(&stats);
+  TMP102_Replay_Close();
+  if (stats.Dropped)
+  {
+    printf("log cut short, the unit made %lu more transfers after it\n",
+           (unsigned long)stats.Dropped);
+  }
+  printf("records %lu, transfers %lu, mismatches %lu, extra %lu, remaining %lu, unlogged %lu\n",
+         (unsigned long)stats.Records, (unsigned long)stats.Transfers,
+         (unsigned long)stats.Mismatches, (unsigned long)stats.Extra,
+         (unsigned long)stats.Remaining, (unsigned long)stats.Unlogged);
+  return (stats.Mismatches || stats.Extra || stats.Remaining) ? 1 : 0;
+}
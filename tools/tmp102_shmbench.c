@@ -0,0 +1,200 @@
+/**
+  ******************************************************************************
+  * @file    tmp102_shmbench.c
+  * @author  Ngonidzashe Gwata
+  * @version V1.1.1
+  * @date    18-October-2026
+  * @brief   Host tool that measures the read cost of the shared memory
+  *          latest-value table, tmp102_shm.c, and checks that no reader ever
+  *          sees a torn slot.
+  *
+  *          Build:  cc -O2 -std=c11 -I. tools/tmp102_shmbench.c tmp102_shm.c
+  *                     -pthread -lrt -o tmp102_shmbench
+  *          Usage:  tmp102_shmbench [devices] [readers] [reads per reader]
+  *
+  *          Each reader thread attaches on its own, as a separate process
+  *          would, and reads devices in turn. The cost is the reader's own
+  *          CPU time per read, so readers outnumbering the cores and being
+  *          time-sliced does not inflate it; the online core count is printed
+  *          alongside, as readers only contend for cache lines in parallel
+  *          when they have cores of their own. It is measured twice:
+  *          idle, and while a publisher thread rewrites every slot as fast
+  *          as it can, which is far harsher than a daemon polling sensors.
+  *          Every publish stores a pattern tying raw, status and both halves
+  *          of the timestamp together, so any torn snapshot is counted.
+  *          Exits 1 if one is seen.
+  ******************************************************************************
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include "tmp102_shm.h"
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <time.h>
+#include <unistd.h>
+
+typedef struct
+{
+  pthread_t Thread;
+  uint32_t Devices;
+  long Reads;
+  double Ns;		/* per read */
+  long Torn;
+  int Attached;
+} Reader;
+
+static char Name[64];
+static TMP102_ShmMap Publisher;
+static atomic_int Stop;
+
+/* CPU time of the calling thread, ns */
+static double ThreadNs(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+  return ts.tv_sec*1e9 + ts.tv_nsec;
+}
+
+/* Every field of a slot derived from one counter: both timestamp halves hold it */
+static void Publish(uint32_t device, uint32_t count)
+{
+  TMP102_Shm_Publish(&Publisher, device, (int16_t)(uint16_t)count, (uint8_t)(count >> 16),
+                     (uint64_t)count << 32 | count);
+}
+
+static void *Publish_Loop(void *arg)
+{
+  uint32_t count = 0, device = 0;
+
+  (void)arg;
+  while (!atomic_load_explicit(&Stop, memory_order_relaxed))
+  {
+    Publish(device, count++);
+    if (++device == Publisher.Devices)
+    {
+      device = 0;
+    }
+  }
+  return 0;
+}
+
+static void *Read_Loop(void *arg)
+{
+  Reader *reader = arg;
+  TMP102_ShmMap map;
+  TMP102_ShmSample sample;
+  uint32_t device = 0, count;
+  double start;
+  long i;
+
+  if (!TMP102_Shm_Attach(Name, &map))
+  {
+    return 0;
+  }
+  reader->Attached = 1;
+  start = ThreadNs();
+  for (i = 0; i < reader->Reads; i++)
+  {
+    TMP102_Shm_Read(&map, device, &sample);
+    count = (uint32_t)sample.Timestamp;
+    if ((uint32_t)(sample.Timestamp >> 32) != count ||
+        sample.Raw != (int16_t)(uint16_t)count || sample.Status != (uint8_t)(count >> 16))
+    {
+      reader->Torn++;
+    }
+    if (++device == map.Devices)
+    {
+      device = 0;
+    }
+  }
+  reader->Ns = (ThreadNs() - start) / reader->Reads;
+  TMP102_Shm_Detach(&map);
+  return 0;
+}
+
+static long Run(Reader *readers, int count, const char *label)
+{
+  double sum = 0, worst = 0;
+  long torn = 0;
+  int i;
+
+  for (i = 0; i < count; i++)
+  {
+    readers[i].Torn = 0;
+    readers[i].Attached = 0;
+    pthread_create(&readers[i].Thread, 0, Read_Loop, &readers[i]);
+  }
+  for (i = 0; i < count; i++)
+  {
+    pthread_join(readers[i].Thread, 0);
+    if (!readers[i].Attached)
+    {
+      fprintf(stderr, "reader %d could not attach\n", i);
+      return -1;
+    }
+    sum += readers[i].Ns;
+    if (readers[i].Ns > worst)
+    {
+      worst = readers[i].Ns;
+    }
+    torn += readers[i].Torn;
+  }
+  printf("  %-12s %8.1f CPU ns/read mean, %8.1f worst reader, %ld torn\n",
+         label, sum / count, worst, torn);
+  return torn;
+}
+
+int main(int argc, char **argv)
+{
+  uint32_t devices = (argc > 1) ? (uint32_t)atol(argv[1]) : 64;
+  int readers = (argc > 2) ? atoi(argv[2]) : 4;
+  long reads = (argc > 3) ? atol(argv[3]) : 10000000;
+  Reader *reader;
+  pthread_t publisher;
+  long idle, busy, cores = sysconf(_SC_NPROCESSORS_ONLN);
+  uint32_t i;
+  int r;
+
+  if (devices == 0 || readers < 1 || reads < 1)
+  {
+    fprintf(stderr, "usage: %s [devices] [readers] [reads per reader]\n", argv[0]);
+    return 2;
+  }
+  snprintf(Name, sizeof Name, "/tmp102_bench_%ld", (long)getpid());
+  if (!TMP102_Shm_Create(Name, devices, &Publisher))
+  {
+    perror(Name);
+    return 2;
+  }
+  for (i = 0; i < devices; i++)
+  {
+    Publish(i, 0);
+  }
+  reader = calloc((size_t)readers, sizeof *reader);
+  for (r = 0; r < readers; r++)
+  {
+    reader[r].Devices = devices;
+    reader[r].Reads = reads;
+  }
+
+  printf("%u devices, %d readers, %ld reads each, %ld online cores\n", devices, readers, reads, cores);
+  if (readers + 1 > cores)
+  {
+    printf("  readers and publisher share cores, they time-slice rather than contend\n");
+  }
+  idle = Run(reader, readers, "idle");
+  pthread_create(&publisher, 0, Publish_Loop, 0);
+  busy = Run(reader, readers, "publishing");
+  atomic_store(&Stop, 1);
+  pthread_join(publisher, 0);
+
+  TMP102_Shm_Detach(&Publisher);
+  shm_unlink(Name);
+  free(reader);
+  return (idle == 0 && busy == 0) ? 0 : 1;
+}
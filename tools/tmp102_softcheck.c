@@ -0,0 +1,212 @@
+/**
+  ******************************************************************************
+  * @file    tmp102_softcheck.c
+  * @author  Ngonidzashe Gwata
+  * @version V1.1.1
+  * @date    18-October-2026
+  * @brief   Host tool that checks the software I2C master's timing model,
+  *          tmp102_soft_timing.c, against the I2C specification.
+  *
+  *          Build:  cc -O2 -I. [-DTMP102_SOFT_xx=...] tools/tmp102_softcheck.c
+  *                     tmp102_soft_timing.c -o tmp102_softcheck
+  *          Usage:  tmp102_softcheck
+  *                  tmp102_softcheck -cal <clock Hz> <tLOW0> <tHIGH0> <tSETUP0>
+  *                                   <tLOW100> <tHIGH100> <tSETUP100>
+  *
+  *          Build with the same TMP102_SOFT_xx values as the firmware. The
+  *          check sweeps core clocks from 500 kHz to 24 MHz in 997 Hz steps,
+  *          so clocks that are not whole kHz are covered, and bit rates from
+  *          10 kHz to 400 kHz. For every pair it verifies, in exact integer
+  *          arithmetic on the cycle counts the model predicts:
+  *            - each Cycles field is its phase's overhead + loops *
+  *              TMP102_SOFT_LOOP_CYCLES, Setup with TMP102_SOFT_SETUP_OVERHEAD
+  *            - tLOW, tBUF, tHIGH, tSU;STA, tHD;STA and tSU;STO minimums of the
+  *              mode the rate falls in
+  *            - f_SCL at or below both the requested rate and the mode maximum
+  *            - no loop count could be one lower without breaking one of these
+  *          then prints the timing at the STM8L HSI clocks for 100 and
+  *          400 kHz. Exits 1 on any violation.
+  *
+  *          -cal turns scope measurements taken as described in
+  *          tmp102_soft_timing.c (times in ns with Low = High = Setup = 0,
+  *          then 100, tSETUP the shortest of tSU;STA, tHD;STA and tSU;STO)
+  *          into the TMP102_SOFT_xx values to build with.
+  ******************************************************************************
+ */
+
+#include "tmp102_soft_timing.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+  * @brief  I2C-bus specification (UM10204) minimums in ns, kept apart from
+  *         the model's own table so a typo in either shows up here.
+  */
+typedef struct
+{
+  uint32_t MaxRate;
+  uint32_t Low, High, SuSta, HdSta, SuSto, Buf;
+} Spec;
+
+static const Spec Standard = {100000, 4700, 4000, 4700, 4000, 4000, 4700};
+static const Spec Fast = {400000, 1300, 600, 600, 600, 600, 1300};
+
+static unsigned long Checked, Failures;
+
+static void Fail(uint32_t clock, uint32_t rate, const char *what)
+{
+  if (Failures++ < 10)
+  {
+    printf("clock %lu Hz, rate %lu Hz: %s\n", (unsigned long)clock, (unsigned long)rate, what);
+  }
+}
+
+/* cycles at clock last at least ns */
+static int Covers(uint32_t cycles, uint32_t clock, uint32_t ns)
+{
+  return (uint64_t)cycles * 1000000000ULL >= (uint64_t)ns * clock;
+}
+
+static void Check(uint32_t clock, uint32_t rate)
+{
+  const Spec *spec = (rate > Standard.MaxRate) ? &Fast : &Standard;
+  uint32_t setup = spec->SuSta;
+  TMP102_SoftTiming t;
+  uint32_t low, high;
+
+  Checked++;
+  if (!TMP102_Soft_ComputeTiming(clock, rate, &t))
+  {
+    Fail(clock, rate, "rejected");
+    return;
+  }
+  if (spec->HdSta > setup) setup = spec->HdSta;
+  if (spec->SuSto > setup) setup = spec->SuSto;
+
+  if (t.LowCycles != TMP102_SOFT_LOW_OVERHEAD + (uint32_t)t.Low * TMP102_SOFT_LOOP_CYCLES ||
+      t.HighCycles != TMP102_SOFT_HIGH_OVERHEAD + (uint32_t)t.High * TMP102_SOFT_LOOP_CYCLES ||
+      t.SetupCycles != TMP102_SOFT_SETUP_OVERHEAD + (uint32_t)t.Setup * TMP102_SOFT_LOOP_CYCLES)
+  {
+    Fail(clock, rate, "cycle counts do not match the loop counts");
+  }
+  if (!Covers(t.LowCycles, clock, spec->Low) || !Covers(t.LowCycles, clock, spec->Buf))
+  {
+    Fail(clock, rate, "tLOW/tBUF too short");
+  }
+  if (!Covers(t.HighCycles, clock, spec->High))
+  {
+    Fail(clock, rate, "tHIGH too short");
+  }
+  if (!Covers(t.SetupCycles, clock, setup))
+  {
+    Fail(clock, rate, "tSU;STA/tHD;STA/tSU;STO too short");
+  }
+  // f_SCL = clock/(low + high) must not exceed the requested rate
+  if ((uint64_t)(t.LowCycles + t.HighCycles) * rate < clock)
+  {
+    Fail(clock, rate, "f_SCL above the requested rate");
+  }
+
+  // One loop less on any phase must break a limit, or the model wasted time
+  if (t.Low)
+  {
+    low = t.LowCycles - TMP102_SOFT_LOOP_CYCLES;
+    if (Covers(low, clock, spec->Low) && Covers(low, clock, spec->Buf) &&
+        (uint64_t)(low + t.HighCycles) * rate >= clock)
+    {
+      Fail(clock, rate, "SCL low longer than needed");
+    }
+  }
+  if (t.High)
+  {
+    high = t.HighCycles - TMP102_SOFT_LOOP_CYCLES;
+    if (Covers(high, clock, spec->High) && (uint64_t)(t.LowCycles + high) * rate >= clock)
+    {
+      Fail(clock, rate, "SCL high longer than needed");
+    }
+  }
+  if (t.Setup && Covers(t.SetupCycles - TMP102_SOFT_LOOP_CYCLES, clock, setup))
+  {
+    Fail(clock, rate, "setup longer than needed");
+  }
+}
+
+static void Print(uint32_t clock, uint32_t rate)
+{
+  TMP102_SoftTiming t;
+
+  TMP102_Soft_ComputeTiming(clock, rate, &t);
+  printf("  %8lu %6lu  %5u %5u %5u  %6lu %6lu %6lu  %7lu\n",
+         (unsigned long)clock, (unsigned long)rate, t.Low, t.High, t.Setup,
+         (unsigned long)((uint64_t)t.LowCycles * 1000000000ULL / clock),
+         (unsigned long)((uint64_t)t.HighCycles * 1000000000ULL / clock),
+         (unsigned long)((uint64_t)t.SetupCycles * 1000000000ULL / clock),
+         (unsigned long)(clock / (t.LowCycles + t.HighCycles)));
+}
+
+static int Calibrate(char **argv)
+{
+  double clock = atof(argv[0]), ns = 1e9 / clock;
+  double low0 = atof(argv[1]) / ns, high0 = atof(argv[2]) / ns, setup0 = atof(argv[3]) / ns;
+  double lowLoop = (atof(argv[4]) / ns - low0) / 100, highLoop = (atof(argv[5]) / ns - high0) / 100;
+  double setupLoop = (atof(argv[6]) / ns - setup0) / 100, loop;
+
+  if (clock <= 0 || lowLoop <= 0 || highLoop <= 0 || setupLoop <= 0)
+  {
+    fprintf(stderr, "times with 100 loops must be longer than with 0\n");
+    return 1;
+  }
+  printf("loop %.2f cycles measured on SCL low, %.2f on SCL high, %.2f on setup\n",
+         lowLoop, highLoop, setupLoop);
+  loop = (lowLoop < highLoop) ? lowLoop : highLoop;
+  loop = (setupLoop < loop) ? setupLoop : loop;
+  // Round the per loop cost down and the overheads down: the model then
+  // predicts at most the real time and every phase it proves is real
+  printf("-DTMP102_SOFT_LOOP_CYCLES=%d -DTMP102_SOFT_LOW_OVERHEAD=%d -DTMP102_SOFT_HIGH_OVERHEAD=%d "
+         "-DTMP102_SOFT_SETUP_OVERHEAD=%d\n", (int)loop, (int)low0, (int)high0, (int)setup0);
+  return 0;
+}
+
+int main(int argc, char **argv)
+{
+  static const uint32_t Clocks[] = {16000000, 8000000, 4000000, 2000000, 1000000};
+  uint32_t clock, rate;
+  unsigned i;
+
+  if (argc == 9 && !strcmp(argv[1], "-cal"))
+  {
+    return Calibrate(argv + 2);
+  }
+  if (argc != 1)
+  {
+    fprintf(stderr, "usage: %s [-cal clock tLOW0 tHIGH0 tSETUP0 tLOW100 tHIGH100 tSETUP100]\n",
+            argv[0]);
+    return 2;
+  }
+
+  for (clock = 500000; clock <= 24000000; clock += 997)
+  {
+    for (rate = 10000; rate <= 400000; rate += 10000)
+    {
+      Check(clock, rate);
+    }
+  }
+  if (Failures)
+  {
+    printf("%lu of %lu timings violate the spec\n", Failures, Checked);
+    return 1;
+  }
+
+  printf("%lu timings meet the spec, loop %d cycles, overhead low %d high %d setup %d\n",
+         Checked, TMP102_SOFT_LOOP_CYCLES, TMP102_SOFT_LOW_OVERHEAD, TMP102_SOFT_HIGH_OVERHEAD,
+         TMP102_SOFT_SETUP_OVERHEAD);
+  printf("     clock   rate    Low  High Setup    tLOW  tHIGH  tSETUP    f_SCL\n");
+  for (i = 0; i < sizeof Clocks / sizeof Clocks[0]; i++)
+  {
+    Print(Clocks[i], 100000);
+    Print(Clocks[i], 400000);
+  }
+  return 0;
+}